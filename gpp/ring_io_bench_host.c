@@ -0,0 +1,767 @@
+/** ============================================================================
+ *  @file   ring_io_bench_host.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   Host benchmarks of the RING_IO sample. They run the DSP side
+ *          helpers of ../ring_io_copy.c on the host, where the input RingIO is
+ *          far larger than the caches, and print the time per span or
+ *          frame: the cache stalls saved by RING_IO_prefetch on the next
+ *          span, and the copy time hidden behind the compute by the worker
+ *          thread engines of RING_IO_copySubmit. A notify ping-pong between
+ *          a GPP thread and a DSP thread over ring_io_local gives the round
+ *          trip through two threads that RING_IO_benchRingIo cannot measure
+ *          on the DSP alone.
+ *          Built with RING_IO_LOCAL defined and linked with ring_io_local.c,
+ *          ../ring_io_copy.c and the pthread library.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/*  This program uses clock_gettime */
+#define _POSIX_C_SOURCE 200112L
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_local.h>
+#include <ring_io_copy.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  BENCH_HOST_RINGSIZE, BENCH_HOST_SPANSIZE
+ *
+ *  @desc   Size of the simulated input RingIO and of each span acquired from
+ *          it. The ring is larger than the last level cache, so each span
+ *          comes from memory as it does after the GPP wrote it.
+ *  ============================================================================
+ */
+#define BENCH_HOST_RINGSIZE     (64u * 1024u * 1024u)
+#define BENCH_HOST_SPANSIZE     4096u
+
+/** ============================================================================
+ *  @const  BENCH_HOST_PASSES
+ *
+ *  @desc   Passes of the stand-in compute over the frame for each span, so
+ *          that the compute lasts about as long as the memory fetch.
+ *  ============================================================================
+ */
+#define BENCH_HOST_PASSES       4u
+
+/** ============================================================================
+ *  @const  BENCH_HOST_FRAMESIZE, BENCH_HOST_BLOCKSIZE
+ *
+ *  @desc   Frame and block size of the copy benchmark. Blocks are large
+ *          enough for a copy to outlast the hand over to the worker thread.
+ *  ============================================================================
+ */
+#define BENCH_HOST_FRAMESIZE    (1024u * 1024u)
+#define BENCH_HOST_BLOCKSIZE    (64u * 1024u)
+
+/** ============================================================================
+ *  @const  BENCH_HOST_PINGPONG_NAME, BENCH_HOST_ROUNDTRIPS
+ *
+ *  @desc   Name of the ping-pong ring and number of round trips timed.
+ *  ============================================================================
+ */
+#define BENCH_HOST_PINGPONG_NAME    "BENCHPING"
+#define BENCH_HOST_ROUNDTRIPS       10000u
+
+/** ============================================================================
+ *  @const  BENCH_HOST_PING
+ *
+ *  @desc   Message of the ping-pong notifications.
+ *  ============================================================================
+ */
+#define BENCH_HOST_PING             0x5A5Au
+
+/** ============================================================================
+ *  @name   BENCH_HOST_Event
+ *
+ *  @desc   Counting event posted by a notifier and pended on by the thread
+ *          owning the RingIO end, as the SEM of a DSP task.
+ *
+ *  @field  lock
+ *              Guards count.
+ *  @field  posted
+ *              Signalled when count is raised.
+ *  @field  count
+ *              Posts not yet pended on.
+ *  ============================================================================
+ */
+typedef struct BENCH_HOST_Event_tag {
+    pthread_mutex_t lock ;
+    pthread_cond_t  posted ;
+    Uint32          count ;
+} BENCH_HOST_Event ;
+
+/** ============================================================================
+ *  @name   BENCH_HOST_PingPong
+ *
+ *  @desc   State of the ping-pong. The GPP thread owns the writer end, the
+ *          DSP thread the reader end; each end's notifier posts the event of
+ *          its owner.
+ *
+ *  @field  writer
+ *              Writer end, GPP thread.
+ *  @field  reader
+ *              Reader end, DSP thread.
+ *  @field  gppEvent
+ *              Posted by the notifier of the writer end.
+ *  @field  dspEvent
+ *              Posted by the notifier of the reader end.
+ *  @field  status
+ *              RINGIO_SUCCESS, or the first failure of the DSP thread.
+ *  ============================================================================
+ */
+typedef struct BENCH_HOST_PingPong_tag {
+    RingIO_Handle    writer ;
+    RingIO_Handle    reader ;
+    BENCH_HOST_Event gppEvent ;
+    BENCH_HOST_Event dspEvent ;
+    Int32            status ;
+} BENCH_HOST_PingPong ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_now
+ *
+ *  @desc   Returns the monotonic time in nanoseconds.
+ *
+ *  @arg    None
+ *
+ *  @ret    Time in nanoseconds.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static
+double
+BENCH_HOST_now (Void) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_compute
+ *
+ *  @desc   Stand-in for the stages run on a frame: scales the frame in place
+ *          BENCH_HOST_PASSES times.
+ *
+ *  @arg    frame
+ *              Frame to compute.
+ *  @arg    size
+ *              Size of the frame in bytes.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_compute (Uint8 * frame, Uint32 size) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_copy
+ *
+ *  @desc   Copies each frame of the ring block by block through engine 0,
+ *          as the frame loop does with RING_IO_ASYNC_COPY, and prints the
+ *          time per frame of the copy alone, of the compute alone and of
+ *          both pipelined, where block N is computed while block N + 1 is
+ *          copied by the worker thread.
+ *
+ *  @arg    ring
+ *              Input ring, BENCH_HOST_RINGSIZE bytes.
+ *  @arg    frame
+ *              Frame, BENCH_HOST_FRAMESIZE bytes.
+ *
+ *  @ret    None
+ *
+ *  @enter  RING_IO_copyInit has succeeded.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_copySubmit, RING_IO_copyWait
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_copy (const Uint8 * ring, Uint8 * frame) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_prefetch
+ *
+ *  @desc   Reads every span of the ring in order, as the frame loop does:
+ *          the frame of the current span is computed, then the next span is
+ *          copied into the frame. With touch set, the next span is passed to
+ *          RING_IO_prefetch before the compute, as TSKRING_IO_prefetchNext
+ *          does with RING_IO_PREFETCH.
+ *
+ *  @arg    ring
+ *              Input ring, BENCH_HOST_RINGSIZE bytes.
+ *  @arg    frame
+ *              Frame, BENCH_HOST_SPANSIZE bytes.
+ *  @arg    touch
+ *              TRUE to prefetch the next span.
+ *
+ *  @ret    Time per span in nanoseconds.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_prefetch
+ *  ----------------------------------------------------------------------------
+ */
+static
+double
+BENCH_HOST_prefetch (const Uint8 * ring, Uint8 * frame, Bool touch) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_notify
+ *
+ *  @desc   Notifier of both ping-pong ends: posts the event of the thread
+ *          owning the end.
+ *
+ *  @arg    handle
+ *              End notified.
+ *  @arg    param
+ *              BENCH_HOST_Event of the end.
+ *  @arg    msg
+ *              Message, not used.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    BENCH_HOST_pend
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_notify (RingIO_Handle      handle,
+                   RingIO_NotifyParam param,
+                   RingIO_NotifyMsg   msg) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_pend
+ *
+ *  @desc   Waits for a post of an event and consumes it.
+ *
+ *  @arg    event
+ *              Event to wait on.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    BENCH_HOST_notify
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_pend (BENCH_HOST_Event * event) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_dspMain
+ *
+ *  @desc   DSP thread of the ping-pong: answers each notification of the
+ *          GPP with one to the writer end, as the DSP task would through
+ *          RingIO_sendNotify.
+ *
+ *  @arg    arg
+ *              BENCH_HOST_PingPong.
+ *
+ *  @ret    NULL
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    BENCH_HOST_pingPong
+ *  ----------------------------------------------------------------------------
+ */
+static
+Pvoid
+BENCH_HOST_dspMain (Pvoid arg) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_pingPong
+ *
+ *  @desc   Times BENCH_HOST_ROUNDTRIPS notify round trips from the GPP
+ *          thread to the DSP thread and back over a ring_io_local RingIO,
+ *          and prints the time per round trip.
+ *
+ *  @arg    None
+ *
+ *  @ret    0 on success, 1 otherwise.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    BENCH_HOST_dspMain
+ *  ----------------------------------------------------------------------------
+ */
+static
+int
+BENCH_HOST_pingPong (Void) ;
+
+
+/** ============================================================================
+ *  @func   main
+ *
+ *  @desc   Runs the benchmarks and prints the results.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+int
+main (int argc, char ** argv)
+{
+    int     status = 0 ;
+    Uint8 * ring ;
+    Uint8 * frame ;
+    Uint8 * copyFrame ;
+    double  cold ;
+    double  touched ;
+
+    (Void) argc ;
+    (Void) argv ;
+
+    ring  = malloc (BENCH_HOST_RINGSIZE) ;
+    frame = malloc (BENCH_HOST_SPANSIZE) ;
+    copyFrame = malloc (BENCH_HOST_FRAMESIZE) ;
+    if ((ring == NULL) || (frame == NULL) || (copyFrame == NULL)) {
+        printf ("ring_io_bench_host: out of memory\n") ;
+        status = 1 ;
+    }
+    else if (RING_IO_copyInit () != SYS_OK) {
+        printf ("ring_io_bench_host: copy workers not started\n") ;
+        status = 1 ;
+    }
+
+    if (status == 0) {
+        memset (ring, 1, BENCH_HOST_RINGSIZE) ;
+        memset (frame, 1, BENCH_HOST_SPANSIZE) ;
+
+        /* A first pass leaves the ring out of the caches for both runs */
+        (Void) BENCH_HOST_prefetch (ring, frame, FALSE) ;
+        cold    = BENCH_HOST_prefetch (ring, frame, FALSE) ;
+        touched = BENCH_HOST_prefetch (ring, frame, TRUE) ;
+        printf ("prefetch cold:    %8.1f ns/span\n", cold) ;
+        printf ("prefetch touched: %8.1f ns/span\n", touched) ;
+        printf ("prefetch saved:   %8.1f ns/span\n",
+                (cold > touched) ? (cold - touched) : 0.0) ;
+
+        memset (copyFrame, 1, BENCH_HOST_FRAMESIZE) ;
+        BENCH_HOST_copy (ring, copyFrame) ;
+
+        status = BENCH_HOST_pingPong () ;
+    }
+
+    free (copyFrame) ;
+    free (frame) ;
+    free (ring) ;
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_now
+ *
+ *  @desc   Returns the monotonic time in nanoseconds.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+double
+BENCH_HOST_now (Void)
+{
+    struct timespec now ;
+
+    clock_gettime (CLOCK_MONOTONIC, &now) ;
+
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_compute
+ *
+ *  @desc   Stand-in for the stages run on a frame.
+ *
+ *  @modif  frame
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_compute (Uint8 * frame, Uint32 size)
+{
+    volatile Uint8 * data = frame ;
+    Uint32           pass ;
+    Uint32           i ;
+
+    /* volatile keeps the passes from being folded into one */
+    for (pass = 0 ; pass < BENCH_HOST_PASSES ; pass++) {
+        for (i = 0 ; i < size ; i++) {
+            data [i] = (Uint8) (data [i] * 3u) ;
+        }
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_copy
+ *
+ *  @desc   Copies each frame of the ring through engine 0.
+ *
+ *  @modif  frame
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_copy (const Uint8 * ring, Uint8 * frame)
+{
+    Uint32 frames = BENCH_HOST_RINGSIZE / BENCH_HOST_FRAMESIZE ;
+    const Uint8 * src ;
+    double start ;
+    double copy ;
+    double compute ;
+    double pipe ;
+    Uint32 offset ;
+    Uint32 n ;
+
+    /* Copy alone */
+    start = BENCH_HOST_now () ;
+    for (n = 0 ; n < frames ; n++) {
+        src = ring + (n * BENCH_HOST_FRAMESIZE) ;
+        for (offset = 0 ;
+             offset < BENCH_HOST_FRAMESIZE ;
+             offset += BENCH_HOST_BLOCKSIZE) {
+            RING_IO_copySubmit (0u,
+                                frame + offset,
+                                src + offset,
+                                BENCH_HOST_BLOCKSIZE) ;
+            RING_IO_copyWait (0u) ;
+        }
+    }
+    copy = (BENCH_HOST_now () - start) / (double) frames ;
+
+    /* Compute alone */
+    start = BENCH_HOST_now () ;
+    for (n = 0 ; n < frames ; n++) {
+        BENCH_HOST_compute (frame, BENCH_HOST_FRAMESIZE) ;
+    }
+    compute = (BENCH_HOST_now () - start) / (double) frames ;
+
+    /* Pipelined: block N is computed while block N + 1 is copied */
+    start = BENCH_HOST_now () ;
+    for (n = 0 ; n < frames ; n++) {
+        src = ring + (n * BENCH_HOST_FRAMESIZE) ;
+        RING_IO_copySubmit (0u, frame, src, BENCH_HOST_BLOCKSIZE) ;
+        RING_IO_copyWait (0u) ;
+        for (offset = 0 ;
+             offset < BENCH_HOST_FRAMESIZE ;
+             offset += BENCH_HOST_BLOCKSIZE) {
+            if ((offset + BENCH_HOST_BLOCKSIZE) < BENCH_HOST_FRAMESIZE) {
+                RING_IO_copySubmit (0u,
+                                    frame + offset + BENCH_HOST_BLOCKSIZE,
+                                    src + offset + BENCH_HOST_BLOCKSIZE,
+                                    BENCH_HOST_BLOCKSIZE) ;
+            }
+            BENCH_HOST_compute (frame + offset, BENCH_HOST_BLOCKSIZE) ;
+            RING_IO_copyWait (0u) ;
+        }
+    }
+    pipe = (BENCH_HOST_now () - start) / (double) frames ;
+
+    printf ("copy:             %8.1f us/frame\n", copy / 1e3) ;
+    printf ("copy compute:     %8.1f us/frame\n", compute / 1e3) ;
+    printf ("copy pipelined:   %8.1f us/frame\n", pipe / 1e3) ;
+    printf ("copy hidden:      %8.1f us/frame\n",
+            ((copy + compute) > pipe) ? (copy + compute - pipe) / 1e3 : 0.0) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_prefetch
+ *
+ *  @desc   Reads every span of the ring in order.
+ *
+ *  @modif  frame
+ *  ----------------------------------------------------------------------------
+ */
+static
+double
+BENCH_HOST_prefetch (const Uint8 * ring, Uint8 * frame, Bool touch)
+{
+    Uint32 spans = BENCH_HOST_RINGSIZE / BENCH_HOST_SPANSIZE ;
+    const Uint8 * next ;
+    double start ;
+    Uint32 n ;
+
+    start = BENCH_HOST_now () ;
+    for (n = 0 ; n < spans ; n++) {
+        next = ring + (n * BENCH_HOST_SPANSIZE) ;
+        if (touch == TRUE) {
+            RING_IO_prefetch (next, BENCH_HOST_SPANSIZE) ;
+        }
+        BENCH_HOST_compute (frame, BENCH_HOST_SPANSIZE) ;
+        memcpy (frame, next, BENCH_HOST_SPANSIZE) ;
+    }
+
+    return (BENCH_HOST_now () - start) / (double) spans ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_notify
+ *
+ *  @desc   Notifier of both ping-pong ends.
+ *
+ *  @modif  The BENCH_HOST_Event of the end.
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_notify (RingIO_Handle      handle,
+                   RingIO_NotifyParam param,
+                   RingIO_NotifyMsg   msg)
+{
+    BENCH_HOST_Event * event = (BENCH_HOST_Event *) param ;
+
+    (Void) handle ;
+    (Void) msg ;
+
+    pthread_mutex_lock (&event->lock) ;
+    event->count++ ;
+    pthread_cond_signal (&event->posted) ;
+    pthread_mutex_unlock (&event->lock) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_pend
+ *
+ *  @desc   Waits for a post of an event.
+ *
+ *  @modif  event
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+BENCH_HOST_pend (BENCH_HOST_Event * event)
+{
+    pthread_mutex_lock (&event->lock) ;
+    while (event->count == 0) {
+        pthread_cond_wait (&event->posted, &event->lock) ;
+    }
+    event->count-- ;
+    pthread_mutex_unlock (&event->lock) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_dspMain
+ *
+ *  @desc   DSP thread of the ping-pong.
+ *
+ *  @modif  The status of the BENCH_HOST_PingPong.
+ *  ----------------------------------------------------------------------------
+ */
+static
+Pvoid
+BENCH_HOST_dspMain (Pvoid arg)
+{
+    BENCH_HOST_PingPong * ping = (BENCH_HOST_PingPong *) arg ;
+    Uint32                n ;
+
+    for (n = 0 ;
+         (n < BENCH_HOST_ROUNDTRIPS) && (ping->status == RINGIO_SUCCESS) ;
+         n++) {
+        BENCH_HOST_pend (&ping->dspEvent) ;
+        if (ping->status == RINGIO_SUCCESS) {
+            ping->status = RingIO_sendNotify (ping->reader, BENCH_HOST_PING) ;
+        }
+    }
+
+    return (NULL) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   BENCH_HOST_pingPong
+ *
+ *  @desc   Times notify round trips between the GPP and the DSP thread.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+int
+BENCH_HOST_pingPong (Void)
+{
+    int                 status  = 0 ;
+    Bool                created = FALSE ;
+    Bool                started = FALSE ;
+    BENCH_HOST_PingPong ping ;
+    RingIO_Attrs        attrs ;
+    pthread_t           dsp ;
+    Int32               sent = RINGIO_SUCCESS ;
+    double              start ;
+    double              roundTrip ;
+    Uint32              n = 0 ;
+
+    memset (&ping, 0, sizeof (ping)) ;
+    memset (&attrs, 0, sizeof (attrs)) ;
+    pthread_mutex_init (&ping.gppEvent.lock, NULL) ;
+    pthread_cond_init (&ping.gppEvent.posted, NULL) ;
+    pthread_mutex_init (&ping.dspEvent.lock, NULL) ;
+    pthread_cond_init (&ping.dspEvent.posted, NULL) ;
+    ping.status = RINGIO_SUCCESS ;
+
+    attrs.dataBufSize = BENCH_HOST_SPANSIZE ;
+    if (RingIO_create (0u, BENCH_HOST_PINGPONG_NAME, &attrs)
+        == RINGIO_SUCCESS) {
+        created = TRUE ;
+        ping.writer = RingIO_open (BENCH_HOST_PINGPONG_NAME,
+                                   RINGIO_MODE_WRITE,
+                                   0u) ;
+        ping.reader = RingIO_open (BENCH_HOST_PINGPONG_NAME,
+                                   RINGIO_MODE_READ,
+                                   0u) ;
+    }
+    if ((ping.writer == NULL) || (ping.reader == NULL)) {
+        printf ("ring_io_bench_host: ping-pong ring not opened\n") ;
+        status = 1 ;
+    }
+
+    if (status == 0) {
+        /* Notifiers are set before the DSP thread starts and not changed */
+        RingIO_setNotifier (ping.writer,
+                            RINGIO_NOTIFICATION_ALWAYS,
+                            0u,
+                            &BENCH_HOST_notify,
+                            &ping.gppEvent) ;
+        RingIO_setNotifier (ping.reader,
+                            RINGIO_NOTIFICATION_ALWAYS,
+                            0u,
+                            &BENCH_HOST_notify,
+                            &ping.dspEvent) ;
+        started = (pthread_create (&dsp,
+                                   NULL,
+                                   &BENCH_HOST_dspMain,
+                                   &ping) == 0) ;
+        if (started == FALSE) {
+            printf ("ring_io_bench_host: DSP thread not started\n") ;
+            status = 1 ;
+        }
+    }
+
+    if (status == 0) {
+        start = BENCH_HOST_now () ;
+        while ((n < BENCH_HOST_ROUNDTRIPS) && (sent == RINGIO_SUCCESS)) {
+            sent = RingIO_sendNotify (ping.writer, BENCH_HOST_PING) ;
+            if (sent == RINGIO_SUCCESS) {
+                BENCH_HOST_pend (&ping.gppEvent) ;
+                n++ ;
+            }
+        }
+        roundTrip =   (BENCH_HOST_now () - start)
+                    / (double) BENCH_HOST_ROUNDTRIPS ;
+        if (sent != RINGIO_SUCCESS) {
+            /* Let the DSP thread out of its pend */
+            ping.status = sent ;
+            BENCH_HOST_notify (ping.reader, &ping.dspEvent, BENCH_HOST_PING) ;
+        }
+        pthread_join (dsp, NULL) ;
+
+        if ((sent != RINGIO_SUCCESS) || (ping.status != RINGIO_SUCCESS)) {
+            printf ("ring_io_bench_host: ping-pong notify failed\n") ;
+            status = 1 ;
+        }
+        else {
+            printf ("ping-pong GPP-DSP: %8.1f us/round trip\n",
+                    roundTrip / 1e3) ;
+        }
+    }
+
+    if (ping.writer != NULL) {
+        RingIO_close (ping.writer) ;
+    }
+    if (ping.reader != NULL) {
+        RingIO_close (ping.reader) ;
+    }
+    if (created == TRUE) {
+        RingIO_delete (0u, BENCH_HOST_PINGPONG_NAME) ;
+    }
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,804 @@
+/** ============================================================================
+ *  @file   ring_io_client.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   GPP side client of the ring_io sample, see ring_io_client.h.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <string.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_client.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientFlush
+ *
+ *  @desc   Releases the received spans held by the client.
+ *
+ *  @arg    client
+ *              The client.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Nothing held, or released.
+ *          Else
+ *              Status of RingIO_release.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientPoll
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RING_IO_clientFlush (RING_IO_Client * client) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientAttr
+ *
+ *  @desc   Takes the attribute at the read position of the receive channel
+ *          and passes it to the callback if it is a fixed one.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    fxn
+ *              Receive callback.
+ *  @arg    arg
+ *              Argument of fxn.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The attribute has been taken.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  The attribute is at the read position.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientPoll
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RING_IO_clientAttr (RING_IO_Client *  client,
+                    RING_IO_ClientFxn fxn,
+                    Pvoid             arg) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientPut
+ *
+ *  @desc   Adds a key/value pair to the pending packed record. A key already
+ *          in the record gets the new value.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    key
+ *              Fixed attribute type or RING_IO_PACK_SIZE.
+ *  @arg    value
+ *              Attribute parameter or span size.
+ *
+ *  @ret    None
+ *
+ *  @enter  client->pack is TRUE.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientPack
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_clientPut (RING_IO_Client * client, Uint32 key, Uint32 value) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientPack
+ *
+ *  @desc   Sets the pending packed record on the send channel, and sends
+ *          NOTIFY_DATA_START if it holds the start of the frame.
+ *
+ *  @arg    client
+ *              The client.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The record has been set, or none was pending.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientPut
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RING_IO_clientPack (RING_IO_Client * client) ;
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientInit
+ *
+ *  @desc   Initializes a client on opened RingIO handles.
+ *
+ *  @modif  client
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientInit (RING_IO_Client * client,
+                    RingIO_Handle    writer,
+                    RingIO_Handle    reader,
+                    Uint32           chunkSize,
+                    Uint32           batchSize)
+{
+    Int32 status = RINGIO_SUCCESS ;
+
+    if ((client == NULL) || (chunkSize == 0u)) {
+        status = RINGIO_EFAILURE ;
+    }
+    else {
+        memset (client, 0, sizeof (RING_IO_Client)) ;
+        client->writer    = writer ;
+        client->reader    = reader ;
+        client->chunkSize = chunkSize ;
+        client->batchSize = batchSize ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientSetWait
+ *
+ *  @desc   Sets the function RING_IO_clientSend calls while the send channel
+ *          is full.
+ *
+ *  @modif  client->wait, client->waitArg
+ *  ============================================================================
+ */
+Void
+RING_IO_clientSetWait (RING_IO_Client *   client,
+                       RING_IO_ClientWait wait,
+                       Pvoid              arg)
+{
+    client->wait    = wait ;
+    client->waitArg = arg ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientSetPack
+ *
+ *  @desc   Selects packed attributes for the send channel.
+ *
+ *  @modif  client->pack
+ *  ============================================================================
+ */
+Void
+RING_IO_clientSetPack (RING_IO_Client * client, Bool pack)
+{
+    client->pack      = pack ;
+    client->packStart = FALSE ;
+    client->packWords = 0u ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientBegin
+ *
+ *  @desc   Starts a frame.
+ *
+ *  @modif  client->frameBytes, client->stats
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientBegin (RING_IO_Client * client, Uint32 stamp)
+{
+    Int32 status = RINGIO_SUCCESS ;
+
+    if (client->pack == TRUE) {
+        /* Set and notified with the first record of the frame */
+        client->packWords = 0u ;
+        client->packStart = TRUE ;
+        RING_IO_clientPut (client, RINGIO_DATA_START, stamp) ;
+    }
+    else {
+        status = RingIO_setAttribute (client->writer,
+                                      0u,
+                                      (Uint16) RINGIO_DATA_START,
+                                      stamp) ;
+        if (status == RINGIO_SUCCESS) {
+            status = RingIO_sendNotify (client->writer,
+                                       (RingIO_NotifyMsg) NOTIFY_DATA_START) ;
+        }
+    }
+
+    if (status == RINGIO_SUCCESS) {
+        client->frameBytes = 0u ;
+        client->packEnd    = FALSE ;
+        client->stats.frames++ ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientFormat
+ *
+ *  @desc   Selects the byte order of the samples of the following frames.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientFormat (RING_IO_Client * client, Uint32 format)
+{
+    Int32 status = RINGIO_SUCCESS ;
+
+    if (client->pack == TRUE) {
+        RING_IO_clientPut (client, RINGIO_DATA_FORMAT, format) ;
+    }
+    else {
+        status = RingIO_setAttribute (client->writer,
+                                      0u,
+                                      (Uint16) RINGIO_DATA_FORMAT,
+                                      format) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientAcquire
+ *
+ *  @desc   Acquires a span of the send channel to be written in place.
+ *
+ *  @modif  client->sendHeld, client->stats
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientAcquire (RING_IO_Client * client,
+                       Uint32           size,
+                       Pvoid *          buf,
+                       Uint32 *         got)
+{
+    Int32         status = RINGIO_SUCCESS ;
+    RingIO_BufPtr span ;
+    Uint32        empty ;
+
+    *got = 0u ;
+
+    if (client->sendHeld != 0u) {
+        status = RINGIO_EWRONGSTATE ;
+    }
+    else {
+        empty = RingIO_getEmptySize (client->writer) ;
+        if (empty == 0u) {
+            client->stats.sendFull++ ;
+            status = RINGIO_EBUFFULL ;
+        }
+        else {
+            size = (size < client->chunkSize) ? size : client->chunkSize ;
+            size = (size < empty) ? size : empty ;
+        }
+    }
+
+    if (status == RINGIO_SUCCESS) {
+        status = RingIO_acquire (client->writer, &span, &size) ;
+        /* A span cut short by the end of the buffer is still usable */
+        if ((size != 0u) && (   (status == RINGIO_SUCCESS)
+                             || (status == RINGIO_EBUFWRAP))) {
+            client->sendHeld = size ;
+            client->stats.sendAcquires++ ;
+            *buf   = (Pvoid) span ;
+            *got   = size ;
+            status = RINGIO_SUCCESS ;
+        }
+        else if (status == RINGIO_SUCCESS) {
+            status = RINGIO_EBUFFULL ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientCommit
+ *
+ *  @desc   Sets the size attribute of the committed bytes at the start of
+ *          the acquired span, releases them to the DSP and gives back the
+ *          rest.
+ *
+ *  @modif  client->sendHeld, client->frameBytes
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientCommit (RING_IO_Client * client, Uint32 size)
+{
+    Int32  status = RINGIO_SUCCESS ;
+    Uint32 vattr [RING_IO_VATTR_SIZE + 1u] ;
+
+    if (size > client->sendHeld) {
+        status = RINGIO_EFAILURE ;
+    }
+    else {
+        if (size != 0u) {
+            /* The DSP is told the size that is released, not the size
+             * that was acquired
+             */
+            if (client->pack == TRUE) {
+                RING_IO_clientPut (client, RING_IO_PACK_SIZE, size) ;
+                status = RING_IO_clientPack (client) ;
+            }
+            else {
+                memset (vattr, 0, sizeof (vattr)) ;
+                vattr [RING_IO_VATTR_SIZE] = size ;
+                status = RingIO_setvAttribute (client->writer,
+                                               0u,
+                                               0u,
+                                               0u,
+                                               (RingIO_BufPtr) vattr,
+                                               sizeof (vattr)) ;
+            }
+            if (status == RINGIO_SUCCESS) {
+                status = RingIO_release (client->writer, size) ;
+            }
+        }
+        if ((status == RINGIO_SUCCESS) && (size < client->sendHeld)) {
+            status = RingIO_cancel (client->writer) ;
+        }
+        if (status == RINGIO_SUCCESS) {
+            client->frameBytes += size ;
+            client->sendHeld    = 0u ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientEnd
+ *
+ *  @desc   Ends a frame.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientEnd (RING_IO_Client * client)
+{
+    Int32 status ;
+
+    if ((client->pack == TRUE) && (client->packWords != 0u)) {
+        /* No span went out: the whole frame is one record */
+        RING_IO_clientPut (client, RINGIO_DATA_END, client->frameBytes) ;
+        status = RING_IO_clientPack (client) ;
+    }
+    else if (client->packEnd == FALSE) {
+        status = RingIO_setAttribute (client->writer,
+                                      0u,
+                                      (Uint16) RINGIO_DATA_END,
+                                      client->frameBytes) ;
+    }
+    else {
+        /* The end went out with the last span */
+        status = RINGIO_SUCCESS ;
+    }
+    if (status == RINGIO_SUCCESS) {
+        client->packEnd = FALSE ;
+        status = RingIO_sendNotify (client->writer,
+                                    (RingIO_NotifyMsg) NOTIFY_DATA_END) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientCommitEnd
+ *
+ *  @desc   Commits the last span of a frame and ends the frame.
+ *
+ *  @modif  client->packEnd, client->packWords
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientCommitEnd (RING_IO_Client * client, Uint32 size)
+{
+    Int32  status ;
+    Uint32 words = client->packWords ;
+
+    if (   (client->pack == TRUE)
+        && (size != 0u)
+        && (size <= client->sendHeld)) {
+        /* The end of the frame goes with its last span */
+        RING_IO_clientPut (client,
+                           RINGIO_DATA_END,
+                           client->frameBytes + size) ;
+        client->packEnd = TRUE ;
+    }
+
+    status = RING_IO_clientCommit (client, size) ;
+    if ((status != RINGIO_SUCCESS) && (client->packEnd == TRUE)) {
+        /* Take the end back while the record is still pending, so the
+         * commit may be retried
+         */
+        if (client->packWords != 0u) {
+            client->packWords = words ;
+        }
+        client->packEnd = FALSE ;
+    }
+
+    if (status == RINGIO_SUCCESS) {
+        status = RING_IO_clientEnd (client) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientSend
+ *
+ *  @desc   Sends a frame from a buffer, in spans of the chunk size.
+ *
+ *  @modif  client
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientSend (RING_IO_Client * client,
+                    const Void *     data,
+                    Uint32           size,
+                    Uint32           stamp)
+{
+    const Uint8 * src = (const Uint8 *) data ;
+    Int32         status ;
+    Bool          ended = FALSE ;
+    Pvoid         span ;
+    Uint32        got ;
+
+    status = RING_IO_clientBegin (client, stamp) ;
+
+    while ((status == RINGIO_SUCCESS) && (size != 0u)) {
+        status = RING_IO_clientAcquire (client, size, &span, &got) ;
+        if (status == RINGIO_SUCCESS) {
+            memcpy (span, src, got) ;
+            if (got == size) {
+                status = RING_IO_clientCommitEnd (client, got) ;
+                ended  = TRUE ;
+            }
+            else {
+                status = RING_IO_clientCommit (client, got) ;
+            }
+            src  += got ;
+            size -= got ;
+        }
+        else if (status == RINGIO_EBUFFULL) {
+            if (client->wait != NULL) {
+                client->wait (client->waitArg) ;
+            }
+            status = RINGIO_SUCCESS ;
+        }
+    }
+
+    if ((status == RINGIO_SUCCESS) && (ended == FALSE)) {
+        status = RING_IO_clientEnd (client) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientStop
+ *
+ *  @desc   Tells the DSP to end its transfers.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientStop (RING_IO_Client * client)
+{
+    return RingIO_sendNotify (client->writer,
+                              (RingIO_NotifyMsg) NOTIFY_DSP_END) ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientSelfTest
+ *
+ *  @desc   Asks the DSP channel to run its loopback self-benchmark.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientSelfTest (RING_IO_Client * client)
+{
+    return RingIO_sendNotify (client->writer,
+                              (RingIO_NotifyMsg) NOTIFY_DSP_SELFTEST) ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientPoll
+ *
+ *  @desc   Takes everything available on the receive channel.
+ *
+ *  @modif  client->recvHeld, client->stats
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientPoll (RING_IO_Client *  client,
+                    RING_IO_ClientFxn fxn,
+                    Pvoid             arg)
+{
+    Int32         status = RINGIO_SUCCESS ;
+    Int32         flushStatus ;
+    Bool          more   = TRUE ;
+    RingIO_BufPtr span ;
+    Uint32        size ;
+
+    while (more == TRUE) {
+        size   = client->chunkSize ;
+        status = RingIO_acquire (client->reader, &span, &size) ;
+
+        if ((size != 0u) && (   (status == RINGIO_SUCCESS)
+                             || (status == RINGIO_ENOTCONTIGUOUSDATA)
+                             || (status == RINGIO_SPENDINGATTRIBUTE))) {
+            /* Spans are held and released together */
+            fxn (arg, RING_IO_CLIENT_DATA, (Pvoid) span, size) ;
+            if (client->recvEnd == TRUE) {
+                client->recvEndLeft -= (size < client->recvEndLeft)
+                                       ? size
+                                       : client->recvEndLeft ;
+                if (client->recvEndLeft == 0u) {
+                    client->recvEnd = FALSE ;
+                    fxn (arg, RINGIO_DATA_END, NULL, client->recvEndParam) ;
+                }
+            }
+            client->recvHeld += size ;
+            client->stats.recvSpans++ ;
+            status = RINGIO_SUCCESS ;
+            if (client->recvHeld >= client->batchSize) {
+                status = RING_IO_clientFlush (client) ;
+            }
+        }
+        else if (status == RINGIO_SPENDINGATTRIBUTE) {
+            status = RING_IO_clientAttr (client, fxn, arg) ;
+        }
+        else {
+            /* Drained: an empty channel is not an error */
+            if (status == RINGIO_EBUFEMPTY) {
+                status = RINGIO_SUCCESS ;
+            }
+            more = FALSE ;
+        }
+
+        if (status != RINGIO_SUCCESS) {
+            more = FALSE ;
+        }
+    }
+
+    /* Give the space back to the DSP before returning */
+    flushStatus = RING_IO_clientFlush (client) ;
+    if (status == RINGIO_SUCCESS) {
+        status = flushStatus ;
+    }
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientFlush
+ *
+ *  @desc   Releases the received spans held by the client.
+ *
+ *  @modif  client->recvHeld, client->stats
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RING_IO_clientFlush (RING_IO_Client * client)
+{
+    Int32 status = RINGIO_SUCCESS ;
+
+    if (client->recvHeld != 0u) {
+        status = RingIO_release (client->reader, client->recvHeld) ;
+        if (status == RINGIO_SUCCESS) {
+            client->recvHeld = 0u ;
+            client->stats.recvReleases++ ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientAttr
+ *
+ *  @desc   Takes the attribute at the read position of the receive channel.
+ *
+ *  @modif  client->stats
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RING_IO_clientAttr (RING_IO_Client *  client,
+                    RING_IO_ClientFxn fxn,
+                    Pvoid             arg)
+{
+    Int32  status ;
+    Uint16 type ;
+    Uint32 param ;
+    Uint32 vattr [RING_IO_CLIENT_VATTR_WORDS] ;
+    Uint32 size ;
+    Uint32 span ;
+    Uint32 i ;
+
+    status = RingIO_getAttribute (client->reader, &type, &param) ;
+    if ((status == RINGIO_SUCCESS) || (status == RINGIO_SPENDINGATTRIBUTE)) {
+        client->stats.recvAttrs++ ;
+        fxn (arg, (Uint32) type, NULL, param) ;
+        status = RINGIO_SUCCESS ;
+    }
+    else if (status == RINGIO_EVARIABLEATTRIBUTE) {
+        /* Size attribute: the spans are passed as acquired */
+        size   = sizeof (vattr) ;
+        status = RingIO_getvAttribute (client->reader,
+                                       &type,
+                                       &param,
+                                       (RingIO_BufPtr) vattr,
+                                       &size) ;
+        if (   (status == RINGIO_SUCCESS)
+            || (status == RINGIO_SPENDINGATTRIBUTE)) {
+            client->stats.recvAttrs++ ;
+            status = RINGIO_SUCCESS ;
+            if (type == (Uint16) RINGIO_DATA_PACKED) {
+                size /= sizeof (Uint32) ;
+                span  = 0u ;
+                for (i = 0u ; (i + 1u) < size ; i += 2u) {
+                    if (vattr [i] == RING_IO_PACK_SIZE) {
+                        span = vattr [i + 1u] ;
+                    }
+                }
+                for (i = 0u ; (i + 1u) < size ; i += 2u) {
+                    if ((vattr [i] == RINGIO_DATA_END) && (span != 0u)) {
+                        /* The end follows the span the record sizes */
+                        client->recvEnd      = TRUE ;
+                        client->recvEndLeft  = span ;
+                        client->recvEndParam = vattr [i + 1u] ;
+                    }
+                    else if (vattr [i] != RING_IO_PACK_SIZE) {
+                        fxn (arg, vattr [i], NULL, vattr [i + 1u]) ;
+                    }
+                }
+            }
+        }
+    }
+
+    return status ;
+}
+
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientPut
+ *
+ *  @desc   Adds a key/value pair to the pending packed record.
+ *
+ *  @modif  client->packBuf, client->packWords
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_clientPut (RING_IO_Client * client, Uint32 key, Uint32 value)
+{
+    Uint32 i ;
+
+    for (i = 0u ;
+         (i < client->packWords) && (client->packBuf [i] != key) ;
+         i += 2u) {
+    }
+
+    if (i < RING_IO_PACK_WORDS) {
+        client->packBuf [i]      = key ;
+        client->packBuf [i + 1u] = value ;
+        if (i == client->packWords) {
+            client->packWords += 2u ;
+        }
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_clientPack
+ *
+ *  @desc   Sets the pending packed record on the send channel.
+ *
+ *  @modif  client->packWords, client->packStart
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RING_IO_clientPack (RING_IO_Client * client)
+{
+    Int32 status = RINGIO_SUCCESS ;
+
+    if (client->packWords != 0u) {
+        status = RingIO_setvAttribute (client->writer,
+                                       0u,
+                                       (Uint16) RINGIO_DATA_PACKED,
+                                       0u,
+                                       (RingIO_BufPtr) client->packBuf,
+                                       client->packWords * sizeof (Uint32)) ;
+        if (status == RINGIO_SUCCESS) {
+            client->packWords = 0u ;
+        }
+    }
+
+    if ((status == RINGIO_SUCCESS) && (client->packStart == TRUE)) {
+        status = RingIO_sendNotify (client->writer,
+                                    (RingIO_NotifyMsg) NOTIFY_DATA_START) ;
+        if (status == RINGIO_SUCCESS) {
+            client->packStart = FALSE ;
+        }
+    }
+
+    return status ;
+}
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,604 @@
+/** ============================================================================
+ *  @file   ring_io_client.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   GPP side client of the ring_io sample. It speaks the frame protocol
+ *          of ring_io_protocol.h on a pair of RingIO channels: frames are sent
+ *          with acquire-write-commit directly into the RingIO buffer, and
+ *          received by polling, with the data spans handed to a callback in
+ *          place and released in batches.
+ *          Built against DSP/BIOS LINK, or against the in-process stand-in of
+ *          ring_io_local.h when RING_IO_LOCAL is defined.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_CLIENT_)
+#define RING_IO_CLIENT_
+
+/*  --------------------------- RingIO Headers ----------------------------- */
+#if defined (RING_IO_LOCAL)
+#include <ring_io_local.h>
+#else /* if defined (RING_IO_LOCAL) */
+#include <dsplink.h>
+#include <ringio.h>
+#endif /* if defined (RING_IO_LOCAL) */
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_protocol.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_CLIENT_DATA
+ *
+ *  @desc   Event passed to the receive callback for a span of data. The
+ *          other events are the fixed attribute types of
+ *          ring_io_protocol.h (RINGIO_DATA_START, RINGIO_DATA_END,
+ *          RINGIO_DATA_SHED, ...), passed with their parameter as size.
+ *          The keys of a packed record are passed the same way, one event
+ *          each.
+ *  ============================================================================
+ */
+#define RING_IO_CLIENT_DATA         0u
+
+/** ============================================================================
+ *  @const  RING_IO_CLIENT_VATTR_WORDS
+ *
+ *  @desc   Largest variable attribute taken from the receive channel, in
+ *          words.
+ *  ============================================================================
+ */
+#define RING_IO_CLIENT_VATTR_WORDS  RING_IO_PACK_WORDS
+
+/** ============================================================================
+ *  @name   RING_IO_ClientFxn
+ *
+ *  @desc   Receive callback.
+ *
+ *  @arg    arg
+ *              Argument given to RING_IO_clientPoll.
+ *  @arg    event
+ *              RING_IO_CLIENT_DATA or a fixed attribute type.
+ *  @arg    data
+ *              Data span in the RingIO buffer, NULL for an attribute. It
+ *              stays valid until the callback returns only; the span is
+ *              released with the following ones.
+ *  @arg    size
+ *              Size of the span in bytes, parameter of an attribute.
+ *  ============================================================================
+ */
+typedef Void (*RING_IO_ClientFxn) (Pvoid  arg,
+                                   Uint32 event,
+                                   Pvoid  data,
+                                   Uint32 size) ;
+
+/** ============================================================================
+ *  @name   RING_IO_ClientWait
+ *
+ *  @desc   Called by RING_IO_clientSend while the send channel is full,
+ *          typically pending on a semaphore posted by the notifier of the
+ *          writer handle.
+ *
+ *  @arg    arg
+ *              Argument given to RING_IO_clientSetWait.
+ *  ============================================================================
+ */
+typedef Void (*RING_IO_ClientWait) (Pvoid arg) ;
+
+/** ============================================================================
+ *  @name   RING_IO_ClientStats
+ *
+ *  @desc   Counters of a client.
+ *
+ *  @field  frames
+ *              Frames sent.
+ *  @field  sendAcquires
+ *              Spans acquired on the send channel.
+ *  @field  sendFull
+ *              Send acquires that found the channel full.
+ *  @field  recvSpans
+ *              Data spans passed to the receive callback.
+ *  @field  recvReleases
+ *              Releases on the receive channel.
+ *  @field  recvAttrs
+ *              Attributes taken from the receive channel.
+ *  ============================================================================
+ */
+typedef struct RING_IO_ClientStats_tag {
+    Uint32    frames ;
+    Uint32    sendAcquires ;
+    Uint32    sendFull ;
+    Uint32    recvSpans ;
+    Uint32    recvReleases ;
+    Uint32    recvAttrs ;
+} RING_IO_ClientStats ;
+
+/** ============================================================================
+ *  @name   RING_IO_Client
+ *
+ *  @desc   State of a client.
+ *
+ *  @field  writer
+ *              Writer handle of the channel to the DSP, NULL if unused.
+ *  @field  reader
+ *              Reader handle of the channel from the DSP, NULL if unused.
+ *  @field  chunkSize
+ *              Largest span acquired at a time, in bytes.
+ *  @field  batchSize
+ *              Received bytes released together.
+ *  @field  sendHeld
+ *              Bytes acquired by RING_IO_clientAcquire, not yet committed.
+ *  @field  recvHeld
+ *              Received bytes passed to the callback, not yet released.
+ *  @field  frameBytes
+ *              Bytes committed in the current frame.
+ *  @field  wait
+ *              Wait function for a full send channel, NULL to retry at once.
+ *  @field  waitArg
+ *              Argument of wait.
+ *  @field  pack
+ *              If TRUE, the attributes of a frame are sent packed.
+ *  @field  packStart
+ *              TRUE while the pending packed record holds the start of the
+ *              frame, to be notified once it is set.
+ *  @field  packWords
+ *              Words of the pending packed record.
+ *  @field  packBuf
+ *              Pending packed record.
+ *  @field  packEnd
+ *              TRUE once the end of the frame has gone out with its last
+ *              span.
+ *  @field  recvEnd
+ *              TRUE while the end of a received frame waits for the rest of
+ *              the span its packed record sizes.
+ *  @field  recvEndLeft
+ *              Bytes of that span not yet passed to the callback.
+ *  @field  recvEndParam
+ *              Parameter of the pending end.
+ *  @field  stats
+ *              Counters.
+ *  ============================================================================
+ */
+typedef struct RING_IO_Client_tag {
+    RingIO_Handle        writer ;
+    RingIO_Handle        reader ;
+    Uint32               chunkSize ;
+    Uint32               batchSize ;
+    Uint32               sendHeld ;
+    Uint32               recvHeld ;
+    Uint32               frameBytes ;
+    RING_IO_ClientWait   wait ;
+    Pvoid                waitArg ;
+    Bool                 pack ;
+    Bool                 packStart ;
+    Uint32               packWords ;
+    Uint32               packBuf [RING_IO_PACK_WORDS] ;
+    Bool                 packEnd ;
+    Bool                 recvEnd ;
+    Uint32               recvEndLeft ;
+    Uint32               recvEndParam ;
+    RING_IO_ClientStats  stats ;
+} RING_IO_Client ;
+
+
+/** ============================================================================
+ *  @func   RING_IO_clientInit
+ *
+ *  @desc   Initializes a client on opened RingIO handles.
+ *
+ *  @arg    client
+ *              Client to initialize.
+ *  @arg    writer
+ *              Writer handle of the channel to the DSP, NULL if the client
+ *              only receives.
+ *  @arg    reader
+ *              Reader handle of the channel from the DSP, NULL if the client
+ *              only sends.
+ *  @arg    chunkSize
+ *              Largest span acquired at a time, in bytes. Larger spans mean
+ *              fewer RingIO calls and size attributes per frame.
+ *  @arg    batchSize
+ *              Received bytes released together. The received spans are
+ *              released at the latest before RING_IO_clientPoll returns.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The client has been initialized.
+ *          RINGIO_EFAILURE
+ *              Invalid argument.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientSetWait
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientInit (RING_IO_Client * client,
+                    RingIO_Handle    writer,
+                    RingIO_Handle    reader,
+                    Uint32           chunkSize,
+                    Uint32           batchSize) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientSetWait
+ *
+ *  @desc   Sets the function RING_IO_clientSend calls while the send channel
+ *          is full. Without one it retries at once.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    wait
+ *              Wait function, NULL for none.
+ *  @arg    arg
+ *              Argument of wait.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientSend
+ *  ============================================================================
+ */
+Void
+RING_IO_clientSetWait (RING_IO_Client *   client,
+                       RING_IO_ClientWait wait,
+                       Pvoid              arg) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientSetPack
+ *
+ *  @desc   Selects packed attributes for the send channel. The start of a
+ *          frame, its format and the size of its first span then go to the
+ *          DSP as one RINGIO_DATA_PACKED attribute, set by
+ *          RING_IO_clientAcquire, and a frame without data as a single
+ *          record including its end. Later spans get a record with their
+ *          size, and RING_IO_clientCommitEnd adds the end of the frame to
+ *          the record of its last span. Packed records on the receive
+ *          channel are always understood.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    pack
+ *              TRUE to pack, FALSE for one attribute per event.
+ *
+ *  @ret    None
+ *
+ *  @enter  No frame is in progress.
+ *
+ *  @leave  None
+ *
+ *  @see    RINGIO_DATA_PACKED
+ *  ============================================================================
+ */
+Void
+RING_IO_clientSetPack (RING_IO_Client * client, Bool pack) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientBegin
+ *
+ *  @desc   Starts a frame: sets the RINGIO_DATA_START attribute and sends
+ *          NOTIFY_DATA_START. When packing, both wait for the first record
+ *          of the frame.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    stamp
+ *              Timestamp of the frame in microseconds for the jitter buffer
+ *              of the DSP, 0 if the frames are not timestamped.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The frame has been started.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  No span is acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientEnd
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientBegin (RING_IO_Client * client, Uint32 stamp) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientFormat
+ *
+ *  @desc   Selects the byte order of the samples of the following frames
+ *          with a RINGIO_DATA_FORMAT attribute.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    format
+ *              RING_IO_FMT_NATIVE, RING_IO_FMT_BE16 or RING_IO_FMT_BE32.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The attribute has been set.
+ *          Else
+ *              Status of RingIO_setAttribute.
+ *
+ *  @enter  A frame has been started and no span is acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientBegin
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientFormat (RING_IO_Client * client, Uint32 format) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientAcquire
+ *
+ *  @desc   Acquires a span of the send channel to be written in place. It
+ *          may be shorter than requested at the end of the RingIO buffer.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    size
+ *              Requested size in bytes, limited to the chunk size.
+ *  @arg    buf
+ *              Location to receive the address of the span.
+ *  @arg    got
+ *              Location to receive the size of the span.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              A span of *got bytes has been acquired.
+ *          RINGIO_EBUFFULL
+ *              The channel is full, nothing has been written to it.
+ *          RINGIO_EWRONGSTATE
+ *              The previous span has not been committed.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  A frame has been started.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientCommit
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientAcquire (RING_IO_Client * client,
+                       Uint32           size,
+                       Pvoid *          buf,
+                       Uint32 *         got) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientCommit
+ *
+ *  @desc   Releases the first size bytes of the acquired span to the DSP,
+ *          preceded by the size attribute the DSP expects, and gives back
+ *          the rest.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    size
+ *              Bytes written to the span.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The bytes have been committed.
+ *          RINGIO_EFAILURE
+ *              More than the acquired size, or no room for the size
+ *              attribute.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  A span has been acquired.
+ *
+ *  @leave  On failure the span is still held and the commit may be
+ *          retried.
+ *
+ *  @see    RING_IO_clientAcquire
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientCommit (RING_IO_Client * client, Uint32 size) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientCommitEnd
+ *
+ *  @desc   Commits the last span of a frame as RING_IO_clientCommit and
+ *          ends the frame as RING_IO_clientEnd. When packing, the end goes
+ *          in the record of the span instead of a separate attribute.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    size
+ *              Bytes written to the span.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The bytes have been committed and the frame ended.
+ *          Else
+ *              As RING_IO_clientCommit or RING_IO_clientEnd.
+ *
+ *  @enter  A span has been acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientCommit, RING_IO_clientEnd
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientCommitEnd (RING_IO_Client * client, Uint32 size) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientEnd
+ *
+ *  @desc   Ends a frame: sets the RINGIO_DATA_END attribute, with the frame
+ *          size as parameter, and sends NOTIFY_DATA_END.
+ *
+ *  @arg    client
+ *              The client.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The frame has been ended.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  No span is acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientBegin
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientEnd (RING_IO_Client * client) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientSend
+ *
+ *  @desc   Sends a frame from a buffer, in spans of the chunk size.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    data
+ *              Frame data.
+ *  @arg    size
+ *              Frame size in bytes.
+ *  @arg    stamp
+ *              Timestamp of the frame, see RING_IO_clientBegin.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The frame has been sent.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  No span is acquired.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientSetWait
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientSend (RING_IO_Client * client,
+                    const Void *     data,
+                    Uint32           size,
+                    Uint32           stamp) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientStop
+ *
+ *  @desc   Tells the DSP to end its transfers with NOTIFY_DSP_END.
+ *
+ *  @arg    client
+ *              The client.
+ *
+ *  @ret    Status of RingIO_sendNotify.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientStop (RING_IO_Client * client) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientSelfTest
+ *
+ *  @desc   Asks the DSP channel to run its loopback self-benchmark with
+ *          NOTIFY_DSP_SELFTEST. It runs between frames on local RingIOs of
+ *          the DSP and reports in the channel statistics; no data flows on
+ *          the client channels.
+ *
+ *  @arg    client
+ *              The client.
+ *
+ *  @ret    Status of RingIO_sendNotify.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientSelfTest (RING_IO_Client * client) ;
+
+/** ============================================================================
+ *  @func   RING_IO_clientPoll
+ *
+ *  @desc   Takes everything available on the receive channel. Data spans are
+ *          passed to the callback in place and released in batches of the
+ *          batch size, and before returning. Attributes are taken without
+ *          releasing the spans before them. Fixed attributes are passed to
+ *          the callback; the size attributes are taken silently.
+ *
+ *  @arg    client
+ *              The client.
+ *  @arg    fxn
+ *              Receive callback.
+ *  @arg    arg
+ *              Argument of fxn.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The channel has been drained.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  None
+ *
+ *  @leave  No received span is held.
+ *
+ *  @see    RING_IO_ClientFxn
+ *  ============================================================================
+ */
+Int32
+RING_IO_clientPoll (RING_IO_Client *  client,
+                    RING_IO_ClientFxn fxn,
+                    Pvoid             arg) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (RING_IO_CLIENT_) */
@@ -0,0 +1,534 @@
+/** ============================================================================
+ *  @file   ring_io_client_test.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   Host test of the GPP client of the RING_IO sample over the
+ *          ring_io_local RingIO stand-in. The client is both the writer and
+ *          the reader of a loopback ring and sends frames whole with
+ *          RING_IO_clientSend and in place with RING_IO_clientAcquire,
+ *          RING_IO_clientCommit and RING_IO_clientCommitEnd, with plain and
+ *          packed attributes. RING_IO_clientPoll takes them back and the
+ *          test checks the data, the start and end of each frame, the
+ *          batched releases, the attributes saved by the packed SIZE and
+ *          END records, and the short acquire at the end of the ring.
+ *          Built with RING_IO_LOCAL defined and linked with
+ *          ring_io_client.c and ring_io_local.c; the exit status is 0 when
+ *          all checks pass.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <stdio.h>
+#include <string.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_client.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  CLIENT_TEST_NAME, CLIENT_TEST_RINGSIZE
+ *
+ *  @desc   Name and data buffer size of the loopback ring. The frames do
+ *          not divide it, so the spans of the second frame wrap.
+ *  ============================================================================
+ */
+#define CLIENT_TEST_NAME        "CLIENTTEST"
+#define CLIENT_TEST_RINGSIZE    1000u
+
+/** ============================================================================
+ *  @const  CLIENT_TEST_FRAMESIZE, CLIENT_TEST_FRAMES
+ *
+ *  @desc   Size and number of the frames sent by each check.
+ *  ============================================================================
+ */
+#define CLIENT_TEST_FRAMESIZE   700u
+#define CLIENT_TEST_FRAMES      6u
+
+/** ============================================================================
+ *  @const  CLIENT_TEST_CHUNK, CLIENT_TEST_BATCH
+ *
+ *  @desc   Chunk size and receive batch size of the client.
+ *  ============================================================================
+ */
+#define CLIENT_TEST_CHUNK       256u
+#define CLIENT_TEST_BATCH       512u
+
+/** ============================================================================
+ *  @name   CLIENT_TEST_Recv
+ *
+ *  @desc   What the receive callback has seen.
+ *
+ *  @field  next
+ *              Expected value of the next data byte; the frames carry a
+ *              running byte count.
+ *  @field  bytes
+ *              Data bytes received.
+ *  @field  frameBytes
+ *              Data bytes received since the last start.
+ *  @field  starts
+ *              RINGIO_DATA_START attributes received.
+ *  @field  ends
+ *              RINGIO_DATA_END attributes received.
+ *  @field  bad
+ *              Data bytes out of sequence, and ends whose parameter is not
+ *              the size of their frame.
+ *  ============================================================================
+ */
+typedef struct CLIENT_TEST_Recv_tag {
+    Uint8     next ;
+    Uint32    bytes ;
+    Uint32    frameBytes ;
+    Uint32    starts ;
+    Uint32    ends ;
+    Uint32    bad ;
+} CLIENT_TEST_Recv ;
+
+/** ============================================================================
+ *  @name   CLIENT_TEST_Run
+ *
+ *  @desc   Results of one check.
+ *
+ *  @field  recv
+ *              What the receive callback has seen.
+ *  @field  stats
+ *              Counters of the client.
+ *  @field  shortAcquires
+ *              Acquires shorter than asked for while the ring had room,
+ *              at its end.
+ *  @field  status
+ *              RINGIO_SUCCESS, or the first failing client call.
+ *  ============================================================================
+ */
+typedef struct CLIENT_TEST_Run_tag {
+    CLIENT_TEST_Recv    recv ;
+    RING_IO_ClientStats stats ;
+    Uint32              shortAcquires ;
+    Int32               status ;
+} CLIENT_TEST_Run ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_recv
+ *
+ *  @desc   Receive callback: checks the data sequence and the end sizes.
+ *
+ *  @arg    arg
+ *              CLIENT_TEST_Recv.
+ *  @arg    event
+ *              RING_IO_CLIENT_DATA or a fixed attribute type.
+ *  @arg    data
+ *              Data span.
+ *  @arg    size
+ *              Size of the span, parameter of an attribute.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_clientPoll
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+CLIENT_TEST_recv (Pvoid arg, Uint32 event, Pvoid data, Uint32 size) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_notify
+ *
+ *  @desc   Notifier of the reader end. The client sends the start and end
+ *          notifications, which ring_io_local only accepts with a notifier
+ *          on the other end; the check polls instead.
+ *
+ *  @arg    handle
+ *              End notified.
+ *  @arg    param
+ *              Not used.
+ *  @arg    msg
+ *              Not used.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+CLIENT_TEST_notify (RingIO_Handle      handle,
+                    RingIO_NotifyParam param,
+                    RingIO_NotifyMsg   msg) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_run
+ *
+ *  @desc   Sends CLIENT_TEST_FRAMES frames through a loopback ring, where
+ *          the client is both the writer and the reader, and polls after
+ *          each frame. With inPlace, each frame is written in place with
+ *          RING_IO_clientAcquire and RING_IO_clientCommit, the last span
+ *          with RING_IO_clientCommitEnd; else it goes with
+ *          RING_IO_clientSend.
+ *
+ *  @arg    run
+ *              Location to receive the results.
+ *  @arg    pack
+ *              TRUE to send the attributes packed.
+ *  @arg    inPlace
+ *              TRUE to write the frames in place.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    CLIENT_TEST_check
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+CLIENT_TEST_run (CLIENT_TEST_Run * run, Bool pack, Bool inPlace) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_check
+ *
+ *  @desc   Checks the results of a run: every frame arrived whole, in
+ *          order and with its start and its end, and the spans were
+ *          released in batches with nothing held after the last poll.
+ *
+ *  @arg    title
+ *              Name of the run, printed with the failures.
+ *  @arg    run
+ *              Results of the run.
+ *
+ *  @ret    Number of failed checks.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    CLIENT_TEST_run
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+CLIENT_TEST_check (const Char8 * title, const CLIENT_TEST_Run * run) ;
+
+
+/** ============================================================================
+ *  @func   main
+ *
+ *  @desc   Runs the client with plain and packed attributes, sending whole
+ *          frames and writing them in place, and compares the attribute
+ *          counts of the plain and packed runs.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+int
+main (int argc, char ** argv)
+{
+    Uint32          failures = 0 ;
+    CLIENT_TEST_Run plainSend ;
+    CLIENT_TEST_Run packSend ;
+    CLIENT_TEST_Run plainPlace ;
+    CLIENT_TEST_Run packPlace ;
+
+    (Void) argc ;
+    (Void) argv ;
+
+    CLIENT_TEST_run (&plainSend, FALSE, FALSE) ;
+    failures += CLIENT_TEST_check ("send", &plainSend) ;
+    CLIENT_TEST_run (&packSend, TRUE, FALSE) ;
+    failures += CLIENT_TEST_check ("packed send", &packSend) ;
+    CLIENT_TEST_run (&plainPlace, FALSE, TRUE) ;
+    failures += CLIENT_TEST_check ("commit", &plainPlace) ;
+    CLIENT_TEST_run (&packPlace, TRUE, TRUE) ;
+    failures += CLIENT_TEST_check ("packed commit", &packPlace) ;
+
+    /* A packed record carries the sizes and the end of the frame */
+    if (packSend.stats.recvAttrs >= plainSend.stats.recvAttrs) {
+        printf ("FAIL packed send: %u attributes, plain %u\n",
+                packSend.stats.recvAttrs, plainSend.stats.recvAttrs) ;
+        failures++ ;
+    }
+    if (packPlace.stats.recvAttrs >= plainPlace.stats.recvAttrs) {
+        printf ("FAIL packed commit: %u attributes, plain %u\n",
+                packPlace.stats.recvAttrs, plainPlace.stats.recvAttrs) ;
+        failures++ ;
+    }
+
+    /* The second frame written in place starts 700 bytes into the ring */
+    if (plainPlace.shortAcquires == 0) {
+        printf ("FAIL commit: no short acquire at the end of the ring\n") ;
+        failures++ ;
+    }
+
+    printf ("ring_io_client_test: %u failure(s)\n", failures) ;
+
+    return (failures == 0) ? 0 : 1 ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_recv
+ *
+ *  @desc   Receive callback.
+ *
+ *  @modif  The CLIENT_TEST_Recv.
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+CLIENT_TEST_recv (Pvoid arg, Uint32 event, Pvoid data, Uint32 size)
+{
+    CLIENT_TEST_Recv * recv  = (CLIENT_TEST_Recv *) arg ;
+    const Uint8 *      bytes = (const Uint8 *) data ;
+    Uint32             i ;
+
+    if (event == RING_IO_CLIENT_DATA) {
+        for (i = 0 ; i < size ; i++) {
+            if (bytes [i] != recv->next) {
+                recv->bad++ ;
+            }
+            recv->next = (Uint8) (bytes [i] + 1u) ;
+        }
+        recv->bytes      += size ;
+        recv->frameBytes += size ;
+    }
+    else if (event == RINGIO_DATA_START) {
+        recv->starts++ ;
+        recv->frameBytes = 0 ;
+    }
+    else if (event == RINGIO_DATA_END) {
+        recv->ends++ ;
+        if (size != recv->frameBytes) {
+            recv->bad++ ;
+        }
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_notify
+ *
+ *  @desc   Notifier of the reader end.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+CLIENT_TEST_notify (RingIO_Handle      handle,
+                    RingIO_NotifyParam param,
+                    RingIO_NotifyMsg   msg)
+{
+    (Void) handle ;
+    (Void) param ;
+    (Void) msg ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_run
+ *
+ *  @desc   Sends the frames through a loopback ring.
+ *
+ *  @modif  run
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+CLIENT_TEST_run (CLIENT_TEST_Run * run, Bool pack, Bool inPlace)
+{
+    RING_IO_Client client ;
+    RingIO_Attrs   attrs ;
+    RingIO_Handle  writer = NULL ;
+    RingIO_Handle  reader = NULL ;
+    Uint8          frame [CLIENT_TEST_FRAMESIZE] ;
+    Uint8          value = 0 ;
+    Uint8 *        span ;
+    Pvoid          buf ;
+    Uint32         got ;
+    Uint32         left ;
+    Uint32         ask ;
+    Uint32         f ;
+    Uint32         i ;
+
+    memset (run, 0, sizeof (*run)) ;
+    memset (&client, 0, sizeof (client)) ;
+    memset (&attrs, 0, sizeof (attrs)) ;
+    run->status = RINGIO_EFAILURE ;
+
+    attrs.dataBufSize = CLIENT_TEST_RINGSIZE ;
+    if (RingIO_create (0u, CLIENT_TEST_NAME, &attrs) == RINGIO_SUCCESS) {
+        writer = RingIO_open (CLIENT_TEST_NAME, RINGIO_MODE_WRITE, 0u) ;
+        reader = RingIO_open (CLIENT_TEST_NAME, RINGIO_MODE_READ, 0u) ;
+    }
+    if ((writer != NULL) && (reader != NULL)) {
+        RingIO_setNotifier (reader,
+                            RINGIO_NOTIFICATION_ALWAYS,
+                            0u,
+                            &CLIENT_TEST_notify,
+                            NULL) ;
+        run->status = RING_IO_clientInit (&client,
+                                          writer,
+                                          reader,
+                                          CLIENT_TEST_CHUNK,
+                                          CLIENT_TEST_BATCH) ;
+        RING_IO_clientSetPack (&client, pack) ;
+    }
+
+    for (f = 0 ;
+         (f < CLIENT_TEST_FRAMES) && (run->status == RINGIO_SUCCESS) ;
+         f++) {
+        if (inPlace == FALSE) {
+            for (i = 0 ; i < CLIENT_TEST_FRAMESIZE ; i++) {
+                frame [i] = value++ ;
+            }
+            run->status = RING_IO_clientSend (&client,
+                                              frame,
+                                              CLIENT_TEST_FRAMESIZE,
+                                              f) ;
+        }
+        else {
+            run->status = RING_IO_clientBegin (&client, f) ;
+            left = CLIENT_TEST_FRAMESIZE ;
+            while ((left != 0) && (run->status == RINGIO_SUCCESS)) {
+                ask = (left < CLIENT_TEST_CHUNK) ? left : CLIENT_TEST_CHUNK ;
+                run->status = RING_IO_clientAcquire (&client, ask, &buf, &got) ;
+                if (run->status == RINGIO_SUCCESS) {
+                    if (got < ask) {
+                        run->shortAcquires++ ;
+                    }
+                    span = (Uint8 *) buf ;
+                    for (i = 0 ; i < got ; i++) {
+                        span [i] = value++ ;
+                    }
+                    left -= got ;
+                    run->status = (left == 0) ?
+                                    RING_IO_clientCommitEnd (&client, got) :
+                                    RING_IO_clientCommit (&client, got) ;
+                }
+            }
+        }
+
+        if (run->status == RINGIO_SUCCESS) {
+            run->status = RING_IO_clientPoll (&client,
+                                              &CLIENT_TEST_recv,
+                                              &run->recv) ;
+        }
+        if ((run->status == RINGIO_SUCCESS) && (client.recvHeld != 0)) {
+            /* Every received span is released before the poll returns */
+            run->status = RINGIO_EWRONGSTATE ;
+        }
+    }
+    run->stats = client.stats ;
+
+    if (writer != NULL) {
+        RingIO_close (writer) ;
+    }
+    if (reader != NULL) {
+        RingIO_close (reader) ;
+    }
+    RingIO_delete (0u, CLIENT_TEST_NAME) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   CLIENT_TEST_check
+ *
+ *  @desc   Checks the results of a run.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+CLIENT_TEST_check (const Char8 * title, const CLIENT_TEST_Run * run)
+{
+    Uint32 failures = 0 ;
+
+    if (run->status != RINGIO_SUCCESS) {
+        printf ("FAIL %s: status %d\n", title, run->status) ;
+        failures++ ;
+    }
+    if (run->recv.bytes != (CLIENT_TEST_FRAMES * CLIENT_TEST_FRAMESIZE)) {
+        printf ("FAIL %s: %u bytes received\n", title, run->recv.bytes) ;
+        failures++ ;
+    }
+    if (run->recv.bad != 0) {
+        printf ("FAIL %s: %u bad bytes or ends\n", title, run->recv.bad) ;
+        failures++ ;
+    }
+    if (   (run->recv.starts != CLIENT_TEST_FRAMES)
+        || (run->recv.ends != CLIENT_TEST_FRAMES)) {
+        printf ("FAIL %s: %u starts, %u ends\n",
+                title, run->recv.starts, run->recv.ends) ;
+        failures++ ;
+    }
+    if (run->stats.frames != CLIENT_TEST_FRAMES) {
+        printf ("FAIL %s: %u frames counted\n", title, run->stats.frames) ;
+        failures++ ;
+    }
+    /* A batch holds two chunks, so the spans are released fewer times */
+    if (   (run->stats.recvReleases == 0)
+        || (run->stats.recvReleases >= run->stats.recvSpans)) {
+        printf ("FAIL %s: %u releases for %u spans\n",
+                title, run->stats.recvReleases, run->stats.recvSpans) ;
+        failures++ ;
+    }
+
+    return failures ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,917 @@
+/** ============================================================================
+ *  @file   ring_io_local.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   In-process stand-in for the GPP RingIO API, see ring_io_local.h.
+ *          Positions are kept as free running byte counts; the buffer offset
+ *          is the count modulo the buffer size. The stand-in is not thread
+ *          safe: both ends are expected to be driven from one thread, or the
+ *          caller serializes the calls.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <stdlib.h>
+#include <string.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_local.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   RingIO_LocalAttr
+ *
+ *  @desc   Attribute held by a ring.
+ *
+ *  @field  offset
+ *              Write count at which the attribute was set.
+ *  @field  type
+ *              Type of the attribute.
+ *  @field  param
+ *              Parameter of the attribute.
+ *  @field  variable
+ *              TRUE for a variable attribute.
+ *  @field  size
+ *              Size of the payload in bytes.
+ *  @field  data
+ *              Payload.
+ *  ============================================================================
+ */
+typedef struct RingIO_LocalAttr_tag {
+    Uint32    offset ;
+    Uint16    type ;
+    Uint32    param ;
+    Bool      variable ;
+    Uint32    size ;
+    Uint8     data [RINGIO_LOCAL_VATTR_SIZE] ;
+} RingIO_LocalAttr ;
+
+/** ============================================================================
+ *  @name   RingIO_LocalRing
+ *
+ *  @desc   A ring with its two ends.
+ *  ============================================================================
+ */
+typedef struct RingIO_LocalRing_tag RingIO_LocalRing ;
+
+/** ============================================================================
+ *  @name   RingIO_LocalEnd
+ *
+ *  @desc   Reader or writer end of a ring. The handles point to it.
+ *
+ *  @field  ring
+ *              Ring of the end.
+ *  @field  mode
+ *              RINGIO_MODE_READ or RINGIO_MODE_WRITE.
+ *  @field  flags
+ *              Open flags.
+ *  @field  opened
+ *              TRUE while the end is open.
+ *  @field  acquired
+ *              Bytes acquired and not yet released.
+ *  @field  notifyType
+ *              Notification type.
+ *  @field  watermark
+ *              Notification watermark in bytes.
+ *  @field  notifyArmed
+ *              FALSE once a RINGIO_NOTIFICATION_ONCE notifier has fired.
+ *  @field  notifyFxn
+ *              Notifier, NULL if none.
+ *  @field  notifyParam
+ *              Parameter of the notifier.
+ *  ============================================================================
+ */
+typedef struct RingIO_LocalEnd_tag {
+    RingIO_LocalRing *   ring ;
+    Uint32               mode ;
+    Uint32               flags ;
+    Bool                 opened ;
+    Uint32               acquired ;
+    RingIO_NotifyType    notifyType ;
+    Uint32               watermark ;
+    Bool                 notifyArmed ;
+    RingIO_NotifyFunc    notifyFxn ;
+    RingIO_NotifyParam   notifyParam ;
+} RingIO_LocalEnd ;
+
+/** ============================================================================
+ *  @name   RingIO_LocalRing_tag
+ *
+ *  @desc   Fields of a ring.
+ *
+ *  @field  used
+ *              TRUE while the ring exists.
+ *  @field  name
+ *              Name of the ring.
+ *  @field  data
+ *              Data buffer.
+ *  @field  size
+ *              Size of the data buffer in bytes.
+ *  @field  written
+ *              Bytes released by the writer since creation.
+ *  @field  read
+ *              Bytes released by the reader since creation.
+ *  @field  attrs
+ *              Attribute queue.
+ *  @field  attrHead
+ *              Index of the oldest attribute in attrs.
+ *  @field  attrCount
+ *              Number of attributes in attrs.
+ *  @field  ends
+ *              Ends of the ring, indexed by mode.
+ *  ============================================================================
+ */
+struct RingIO_LocalRing_tag {
+    Bool               used ;
+    Char8              name [RINGIO_LOCAL_NAME_LEN] ;
+    Uint8 *            data ;
+    Uint32             size ;
+    Uint32             written ;
+    Uint32             read ;
+    RingIO_LocalAttr   attrs [RINGIO_LOCAL_ATTRS] ;
+    Uint32             attrHead ;
+    Uint32             attrCount ;
+    RingIO_LocalEnd    ends [2] ;
+} ;
+
+/** ============================================================================
+ *  @name   RingIO_localRings
+ *
+ *  @desc   The rings.
+ *  ============================================================================
+ */
+static RingIO_LocalRing RingIO_localRings [RINGIO_LOCAL_RINGS] ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localFind
+ *
+ *  @desc   Looks up a ring by name.
+ *
+ *  @arg    name
+ *              Name of the ring.
+ *
+ *  @ret    The ring, NULL if there is none of that name.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static
+RingIO_LocalRing *
+RingIO_localFind (const Char8 * name) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localNotify
+ *
+ *  @desc   Calls the notifier of an end if the level reaches its watermark.
+ *
+ *  @arg    end
+ *              End to notify.
+ *  @arg    level
+ *              Valid bytes for a reader, empty bytes for a writer.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_release
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RingIO_localNotify (RingIO_LocalEnd * end, Uint32 level) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localAttr
+ *
+ *  @desc   Returns the attribute at the read position of the reader.
+ *
+ *  @arg    end
+ *              Reader end.
+ *  @arg    attr
+ *              Location to receive the attribute.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              *attr is at the read position.
+ *          RINGIO_EPENDINGDATA
+ *              Data not yet acquired precedes the attribute.
+ *          RINGIO_EFAILURE
+ *              No attribute.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_localPop
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RingIO_localAttr (RingIO_LocalEnd * end, RingIO_LocalAttr ** attr) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localPop
+ *
+ *  @desc   Removes the oldest attribute of a ring.
+ *
+ *  @arg    ring
+ *              The ring.
+ *
+ *  @ret    RINGIO_SPENDINGATTRIBUTE if another attribute is at the same
+ *          position, RINGIO_SUCCESS otherwise.
+ *
+ *  @enter  The ring holds an attribute.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_localAttr
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RingIO_localPop (RingIO_LocalRing * ring) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localPush
+ *
+ *  @desc   Adds an attribute at the write position of the writer.
+ *
+ *  @arg    end
+ *              Writer end.
+ *  @arg    type
+ *              Type of the attribute.
+ *  @arg    param
+ *              Parameter of the attribute.
+ *  @arg    pdata
+ *              Payload, NULL for a fixed attribute.
+ *  @arg    size
+ *              Size of the payload.
+ *
+ *  @ret    As RingIO_setAttribute.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_setAttribute, RingIO_setvAttribute
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RingIO_localPush (RingIO_LocalEnd * end,
+                  Uint16            type,
+                  Uint32            param,
+                  const Void *      pdata,
+                  Uint32            size) ;
+
+
+/** ============================================================================
+ *  @func   RingIO_create
+ *
+ *  @desc   Creates a ring with a data buffer of attrs->dataBufSize bytes.
+ *
+ *  @modif  RingIO_localRings
+ *  ============================================================================
+ */
+Int32
+RingIO_create (Uint32 procId, const Char8 * name, RingIO_Attrs * attrs)
+{
+    Int32              status = RINGIO_EFAILURE ;
+    RingIO_LocalRing * ring   = NULL ;
+    Uint32             i ;
+
+    (Void) procId ;
+
+    if (   (name != NULL)
+        && (attrs != NULL)
+        && (attrs->dataBufSize != 0u)
+        && (strlen (name) < RINGIO_LOCAL_NAME_LEN)
+        && (RingIO_localFind (name) == NULL)) {
+        for (i = 0u ; (i < RINGIO_LOCAL_RINGS) && (ring == NULL) ; i++) {
+            if (RingIO_localRings [i].used == FALSE) {
+                ring = &RingIO_localRings [i] ;
+            }
+        }
+    }
+
+    if (ring != NULL) {
+        memset (ring, 0, sizeof (RingIO_LocalRing)) ;
+        ring->data = (Uint8 *) malloc (attrs->dataBufSize) ;
+        if (ring->data != NULL) {
+            strcpy (ring->name, name) ;
+            ring->size = attrs->dataBufSize ;
+            ring->ends [RINGIO_MODE_READ].ring  = ring ;
+            ring->ends [RINGIO_MODE_READ].mode  = RINGIO_MODE_READ ;
+            ring->ends [RINGIO_MODE_WRITE].ring = ring ;
+            ring->ends [RINGIO_MODE_WRITE].mode = RINGIO_MODE_WRITE ;
+            ring->used = TRUE ;
+            status = RINGIO_SUCCESS ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_delete
+ *
+ *  @desc   Deletes a ring. Both ends must be closed.
+ *
+ *  @modif  RingIO_localRings
+ *  ============================================================================
+ */
+Int32
+RingIO_delete (Uint32 procId, const Char8 * name)
+{
+    Int32              status = RINGIO_EFAILURE ;
+    RingIO_LocalRing * ring ;
+
+    (Void) procId ;
+
+    ring = RingIO_localFind (name) ;
+    if (   (ring != NULL)
+        && (ring->ends [RINGIO_MODE_READ].opened == FALSE)
+        && (ring->ends [RINGIO_MODE_WRITE].opened == FALSE)) {
+        free (ring->data) ;
+        memset (ring, 0, sizeof (RingIO_LocalRing)) ;
+        status = RINGIO_SUCCESS ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_open
+ *
+ *  @desc   Opens the reader or the writer end of a ring.
+ *
+ *  @modif  The end.
+ *  ============================================================================
+ */
+RingIO_Handle
+RingIO_open (const Char8 * name, Uint32 mode, Uint32 flags)
+{
+    RingIO_LocalEnd *  end  = NULL ;
+    RingIO_LocalRing * ring ;
+
+    ring = RingIO_localFind (name) ;
+    if (   (ring != NULL)
+        && (mode <= RINGIO_MODE_WRITE)
+        && (ring->ends [mode].opened == FALSE)) {
+        end = &ring->ends [mode] ;
+        end->flags       = flags ;
+        end->acquired    = 0u ;
+        end->notifyType  = RINGIO_NOTIFICATION_NONE ;
+        end->watermark   = 0u ;
+        end->notifyArmed = FALSE ;
+        end->notifyFxn   = NULL ;
+        end->notifyParam = NULL ;
+        end->opened      = TRUE ;
+    }
+
+    return end ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_close
+ *
+ *  @desc   Closes an end of a ring. Acquired data is cancelled.
+ *
+ *  @modif  The end.
+ *  ============================================================================
+ */
+Int32
+RingIO_close (RingIO_Handle handle)
+{
+    handle->acquired  = 0u ;
+    handle->notifyFxn = NULL ;
+    handle->opened    = FALSE ;
+
+    return RINGIO_SUCCESS ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_acquire
+ *
+ *  @desc   Acquires up to *size bytes at the position of the end.
+ *
+ *  @modif  The end.
+ *  ============================================================================
+ */
+Int32
+RingIO_acquire (RingIO_Handle handle, RingIO_BufPtr * buf, Uint32 * size)
+{
+    Int32              status = RINGIO_SUCCESS ;
+    RingIO_LocalRing * ring   = handle->ring ;
+    Uint32             want   = *size ;
+    Uint32             pos ;
+    Uint32             avail ;
+    Uint32             got ;
+    Uint32             contig ;
+    Uint32             dist ;
+
+    if (handle->mode == RINGIO_MODE_WRITE) {
+        pos   = ring->written + handle->acquired ;
+        avail = ring->size - (pos - ring->read) ;
+    }
+    else {
+        pos   = ring->read + handle->acquired ;
+        avail = ring->written - pos ;
+    }
+
+    got    = (want < avail) ? want : avail ;
+    contig = ring->size - (pos % ring->size) ;
+    if (got > contig) {
+        got    = contig ;
+        status = (handle->mode == RINGIO_MODE_WRITE) ? RINGIO_EBUFWRAP
+                                                     : RINGIO_ENOTCONTIGUOUSDATA ;
+    }
+
+    /* The reader stops at the next attribute */
+    if ((handle->mode == RINGIO_MODE_READ) && (ring->attrCount != 0u)) {
+        dist = ring->attrs [ring->attrHead].offset - pos ;
+        if (dist <= got) {
+            got    = dist ;
+            status = RINGIO_SPENDINGATTRIBUTE ;
+        }
+    }
+
+    if (   ((got == 0u) && (status != RINGIO_SPENDINGATTRIBUTE))
+        || (   (got < want)
+            && ((handle->flags & RINGIO_NEED_EXACT_SIZE) != 0u))) {
+        if (status == RINGIO_SUCCESS) {
+            status = (handle->mode == RINGIO_MODE_WRITE) ? RINGIO_EBUFFULL
+                                                         : RINGIO_EBUFEMPTY ;
+        }
+        got = 0u ;
+        handle->notifyArmed = TRUE ;
+    }
+
+    *buf  = (RingIO_BufPtr) (ring->data + (pos % ring->size)) ;
+    *size = got ;
+    handle->acquired += got ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_release
+ *
+ *  @desc   Releases the first size bytes acquired by the end.
+ *
+ *  @modif  The ring.
+ *  ============================================================================
+ */
+Int32
+RingIO_release (RingIO_Handle handle, Uint32 size)
+{
+    Int32              status = RINGIO_SUCCESS ;
+    RingIO_LocalRing * ring   = handle->ring ;
+    RingIO_LocalEnd *  peer ;
+
+    if (size > handle->acquired) {
+        status = RINGIO_EFAILURE ;
+    }
+    else {
+        handle->acquired -= size ;
+        if (handle->mode == RINGIO_MODE_WRITE) {
+            ring->written += size ;
+            peer = &ring->ends [RINGIO_MODE_READ] ;
+            RingIO_localNotify (peer,
+                                ring->written - (ring->read + peer->acquired)) ;
+        }
+        else {
+            ring->read += size ;
+            peer = &ring->ends [RINGIO_MODE_WRITE] ;
+            RingIO_localNotify (peer,
+                                  ring->size
+                                - ((ring->written + peer->acquired) - ring->read)) ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_cancel
+ *
+ *  @desc   Gives back all the bytes acquired by the end.
+ *
+ *  @modif  The end.
+ *  ============================================================================
+ */
+Int32
+RingIO_cancel (RingIO_Handle handle)
+{
+    handle->acquired = 0u ;
+
+    return RINGIO_SUCCESS ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_setAttribute
+ *
+ *  @desc   Writer: attaches a fixed attribute at the current write position,
+ *          the start of any span the writer holds.
+ *
+ *  @modif  The ring.
+ *  ============================================================================
+ */
+Int32
+RingIO_setAttribute (RingIO_Handle handle,
+                     Uint16        dummy,
+                     Uint16        type,
+                     Uint32        param)
+{
+    (Void) dummy ;
+
+    return RingIO_localPush (handle, type, param, NULL, 0u) ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_setvAttribute
+ *
+ *  @desc   Writer: attaches a variable attribute at the current write
+ *          position.
+ *
+ *  @modif  The ring.
+ *  ============================================================================
+ */
+Int32
+RingIO_setvAttribute (RingIO_Handle handle,
+                      Uint16        dummy,
+                      Uint16        type,
+                      Uint32        param,
+                      RingIO_BufPtr pdata,
+                      Uint32        size)
+{
+    (Void) dummy ;
+
+    return RingIO_localPush (handle, type, param, pdata, size) ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getAttribute
+ *
+ *  @desc   Reader: takes the fixed attribute at the current read position.
+ *
+ *  @modif  The ring.
+ *  ============================================================================
+ */
+Int32
+RingIO_getAttribute (RingIO_Handle handle, Uint16 * type, Uint32 * param)
+{
+    Int32              status ;
+    RingIO_LocalAttr * attr ;
+
+    status = RingIO_localAttr (handle, &attr) ;
+    if (status == RINGIO_SUCCESS) {
+        *type  = attr->type ;
+        *param = attr->param ;
+        if (attr->variable == TRUE) {
+            status = RINGIO_EVARIABLEATTRIBUTE ;
+        }
+        else {
+            status = RingIO_localPop (handle->ring) ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getvAttribute
+ *
+ *  @desc   Reader: takes the fixed or variable attribute at the current read
+ *          position.
+ *
+ *  @modif  The ring.
+ *  ============================================================================
+ */
+Int32
+RingIO_getvAttribute (RingIO_Handle handle,
+                      Uint16 *      type,
+                      Uint32 *      param,
+                      RingIO_BufPtr vptr,
+                      Uint32 *      size)
+{
+    Int32              status ;
+    RingIO_LocalAttr * attr ;
+
+    status = RingIO_localAttr (handle, &attr) ;
+    if (status == RINGIO_SUCCESS) {
+        *type  = attr->type ;
+        *param = attr->param ;
+        if (attr->size > *size) {
+            status = RINGIO_EVARIABLEATTRIBUTE ;
+        }
+        else {
+            if (attr->size != 0u) {
+                memcpy (vptr, attr->data, attr->size) ;
+            }
+            status = RingIO_localPop (handle->ring) ;
+        }
+        *size = attr->size ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_setNotifier
+ *
+ *  @desc   Sets the notifier of an end.
+ *
+ *  @modif  The end.
+ *  ============================================================================
+ */
+Int32
+RingIO_setNotifier (RingIO_Handle      handle,
+                    RingIO_NotifyType  type,
+                    Uint32             watermark,
+                    RingIO_NotifyFunc  fxn,
+                    RingIO_NotifyParam param)
+{
+    handle->notifyType  = type ;
+    handle->watermark   = watermark ;
+    handle->notifyFxn   = fxn ;
+    handle->notifyParam = param ;
+    handle->notifyArmed = TRUE ;
+
+    return RINGIO_SUCCESS ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_sendNotify
+ *
+ *  @desc   Calls the notifier of the other end with a message.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int32
+RingIO_sendNotify (RingIO_Handle handle, RingIO_NotifyMsg msg)
+{
+    Int32             status = RINGIO_EFAILURE ;
+    RingIO_LocalEnd * peer ;
+
+    peer = &handle->ring->ends [RINGIO_MODE_WRITE - handle->mode] ;
+    if ((peer->opened == TRUE) && (peer->notifyFxn != NULL)) {
+        peer->notifyFxn (peer, peer->notifyParam, msg) ;
+        status = RINGIO_SUCCESS ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getValidSize
+ *
+ *  @desc   Bytes written and not yet acquired by the reader.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Uint32
+RingIO_getValidSize (RingIO_Handle handle)
+{
+    RingIO_LocalRing * ring = handle->ring ;
+
+    return   ring->written
+           - (ring->read + ring->ends [RINGIO_MODE_READ].acquired) ;
+}
+
+
+/** ============================================================================
+ *  @func   RingIO_getEmptySize
+ *
+ *  @desc   Bytes the writer can still acquire.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Uint32
+RingIO_getEmptySize (RingIO_Handle handle)
+{
+    RingIO_LocalRing * ring = handle->ring ;
+
+    return   ring->size
+           - (  (ring->written + ring->ends [RINGIO_MODE_WRITE].acquired)
+              - ring->read) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localFind
+ *
+ *  @desc   Looks up a ring by name.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+RingIO_LocalRing *
+RingIO_localFind (const Char8 * name)
+{
+    RingIO_LocalRing * ring = NULL ;
+    Uint32             i ;
+
+    for (i = 0u ; (i < RINGIO_LOCAL_RINGS) && (ring == NULL) ; i++) {
+        if (   (RingIO_localRings [i].used == TRUE)
+            && (strcmp (RingIO_localRings [i].name, name) == 0)) {
+            ring = &RingIO_localRings [i] ;
+        }
+    }
+
+    return ring ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localNotify
+ *
+ *  @desc   Calls the notifier of an end if the level reaches its watermark.
+ *
+ *  @modif  end->notifyArmed
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RingIO_localNotify (RingIO_LocalEnd * end, Uint32 level)
+{
+    if (   (end->opened == TRUE)
+        && (end->notifyFxn != NULL)
+        && (end->notifyType != RINGIO_NOTIFICATION_NONE)
+        && (end->notifyArmed == TRUE)
+        && (level >= end->watermark)) {
+        if (end->notifyType == RINGIO_NOTIFICATION_ONCE) {
+            end->notifyArmed = FALSE ;
+        }
+        end->notifyFxn (end, end->notifyParam, 0u) ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localAttr
+ *
+ *  @desc   Returns the attribute at the read position of the reader.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RingIO_localAttr (RingIO_LocalEnd * end, RingIO_LocalAttr ** attr)
+{
+    Int32              status = RINGIO_EFAILURE ;
+    RingIO_LocalRing * ring   = end->ring ;
+
+    if (ring->attrCount != 0u) {
+        *attr = &ring->attrs [ring->attrHead] ;
+        if ((*attr)->offset != (ring->read + end->acquired)) {
+            status = RINGIO_EPENDINGDATA ;
+        }
+        else {
+            status = RINGIO_SUCCESS ;
+        }
+    }
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localPop
+ *
+ *  @desc   Removes the oldest attribute of a ring.
+ *
+ *  @modif  ring->attrHead, ring->attrCount
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RingIO_localPop (RingIO_LocalRing * ring)
+{
+    Int32  status = RINGIO_SUCCESS ;
+    Uint32 offset ;
+
+    offset = ring->attrs [ring->attrHead].offset ;
+    ring->attrHead = (ring->attrHead + 1u) % RINGIO_LOCAL_ATTRS ;
+    ring->attrCount-- ;
+
+    if (   (ring->attrCount != 0u)
+        && (ring->attrs [ring->attrHead].offset == offset)) {
+        status = RINGIO_SPENDINGATTRIBUTE ;
+    }
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RingIO_localPush
+ *
+ *  @desc   Adds an attribute at the write position of the writer.
+ *
+ *  @modif  ring->attrs, ring->attrCount
+ *  ----------------------------------------------------------------------------
+ */
+static
+Int32
+RingIO_localPush (RingIO_LocalEnd * end,
+                  Uint16            type,
+                  Uint32            param,
+                  const Void *      pdata,
+                  Uint32            size)
+{
+    Int32              status = RINGIO_SUCCESS ;
+    RingIO_LocalRing * ring   = end->ring ;
+    RingIO_LocalAttr * attr ;
+
+    /* An acquired span starts at the write position, so the attribute
+     * comes before its data
+     */
+    if (   (ring->attrCount == RINGIO_LOCAL_ATTRS)
+        || (size > RINGIO_LOCAL_VATTR_SIZE)) {
+        status = RINGIO_EFAILURE ;
+    }
+    else {
+        attr = &ring->attrs [  (ring->attrHead + ring->attrCount)
+                             % RINGIO_LOCAL_ATTRS] ;
+        attr->offset   = ring->written ;
+        attr->type     = type ;
+        attr->param    = param ;
+        attr->variable = (pdata != NULL) ? TRUE : FALSE ;
+        attr->size     = size ;
+        if (size != 0u) {
+            memcpy (attr->data, pdata, size) ;
+        }
+        ring->attrCount++ ;
+    }
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
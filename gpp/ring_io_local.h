@@ -0,0 +1,626 @@
+/** ============================================================================
+ *  @file   ring_io_local.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   In-process stand-in for the GPP RingIO API. It implements the
+ *          subset of calls used by the RingIO client library on a plain
+ *          memory ring, so that the library and the applications built on it
+ *          can be exercised on a host without DSP/BIOS LINK. Selected by
+ *          building with RING_IO_LOCAL defined.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_LOCAL_)
+#define RING_IO_LOCAL_
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <stddef.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  Basic types of the GPP side of DSP/BIOS LINK (gpptypes.h).
+ *  ============================================================================
+ */
+typedef void            Void ;
+typedef void *          Pvoid ;
+typedef char            Char8 ;
+typedef unsigned char   Uint8 ;
+typedef unsigned short  Uint16 ;
+typedef unsigned int    Uint32 ;
+typedef int             Int32 ;
+typedef unsigned short  Bool ;
+typedef double          Real64 ;
+
+/*  ============================================================================
+ *  DSP/BIOS names used by the sample sources shared with the DSP
+ *  (ring_io_place.c).
+ *  ============================================================================
+ */
+typedef char            Char ;
+typedef int             Int ;
+
+#define SYS_OK          0
+#define SYS_EALLOC      1
+#define SYS_EINVAL      5
+
+#if !defined (TRUE)
+#define TRUE            1u
+#endif
+#if !defined (FALSE)
+#define FALSE           0u
+#endif
+
+/** ============================================================================
+ *  @name   RingIO status codes
+ *
+ *  @desc   Status codes returned by the RingIO calls. Non negative values are
+ *          successes, some of them carrying extra information.
+ *  ============================================================================
+ */
+#define RINGIO_SUCCESS              0
+#define RINGIO_ENOTCONTIGUOUSDATA   1
+#define RINGIO_EBUFWRAP             2
+#define RINGIO_SPENDINGATTRIBUTE    3
+#define RINGIO_EFAILURE            -1
+#define RINGIO_EBUFEMPTY           -2
+#define RINGIO_EBUFFULL            -3
+#define RINGIO_EVARIABLEATTRIBUTE  -4
+#define RINGIO_EWRONGSTATE         -5
+#define RINGIO_EPENDINGDATA        -6
+
+/** ============================================================================
+ *  @name   RingIO open modes, flags and notification types
+ *
+ *  @desc   Mode and flags of RingIO_open, types of RingIO_setNotifier. The
+ *          cache flags are accepted and ignored.
+ *  ============================================================================
+ */
+#define RINGIO_MODE_READ                    0u
+#define RINGIO_MODE_WRITE                   1u
+
+#define RINGIO_DATABUF_CACHEUSE             0x1u
+#define RINGIO_ATTRBUF_CACHEUSE             0x2u
+#define RINGIO_CONTROL_CACHEUSE             0x4u
+#define RINGIO_NEED_EXACT_SIZE              0x8u
+
+#define RINGIO_NOTIFICATION_NONE            0u
+#define RINGIO_NOTIFICATION_ALWAYS          1u
+#define RINGIO_NOTIFICATION_ONCE            2u
+
+#define RINGIO_TRANSPORT_GPP_DSP            1u
+
+/** ============================================================================
+ *  @const  RINGIO_LOCAL_RINGS
+ *
+ *  @desc   Number of rings that may exist at a time.
+ *  ============================================================================
+ */
+#define RINGIO_LOCAL_RINGS      4u
+
+/** ============================================================================
+ *  @const  RINGIO_LOCAL_ATTRS
+ *
+ *  @desc   Number of attributes a ring can hold at a time.
+ *  ============================================================================
+ */
+#define RINGIO_LOCAL_ATTRS      32u
+
+/** ============================================================================
+ *  @const  RINGIO_LOCAL_VATTR_SIZE
+ *
+ *  @desc   Largest variable attribute payload, in bytes.
+ *  ============================================================================
+ */
+#define RINGIO_LOCAL_VATTR_SIZE 32u
+
+/** ============================================================================
+ *  @const  RINGIO_LOCAL_NAME_LEN
+ *
+ *  @desc   Longest ring name, including the terminator.
+ *  ============================================================================
+ */
+#define RINGIO_LOCAL_NAME_LEN   32u
+
+/** ============================================================================
+ *  @name   RingIO_Handle, RingIO_BufPtr, RingIO_NotifyParam, RingIO_NotifyMsg
+ *
+ *  @desc   Handle of an opened end of a ring, and the types of the
+ *          notification callback.
+ *  ============================================================================
+ */
+typedef struct RingIO_LocalEnd_tag * RingIO_Handle ;
+typedef Pvoid                        RingIO_BufPtr ;
+typedef Pvoid                        RingIO_NotifyParam ;
+typedef Uint16                       RingIO_NotifyMsg ;
+typedef Uint32                       RingIO_NotifyType ;
+
+/** ============================================================================
+ *  @name   RingIO_NotifyFunc
+ *
+ *  @desc   Notification callback, see RingIO_setNotifier.
+ *  ============================================================================
+ */
+typedef Void (*RingIO_NotifyFunc) (RingIO_Handle      handle,
+                                   RingIO_NotifyParam param,
+                                   RingIO_NotifyMsg   msg) ;
+
+/** ============================================================================
+ *  @name   RingIO_Attrs
+ *
+ *  @desc   Creation attributes of a ring. Only dataBufSize is used; the
+ *          stand-in has no foot buffer and a fixed attribute capacity.
+ *
+ *  @field  transportType
+ *              Accepted and ignored.
+ *  @field  ctrlPoolId, dataPoolId, attrPoolId, lockPoolId
+ *              Accepted and ignored.
+ *  @field  dataBufSize
+ *              Size of the data buffer in bytes.
+ *  @field  footBufSize
+ *              Accepted and ignored.
+ *  @field  attrBufSize
+ *              Accepted and ignored.
+ *  ============================================================================
+ */
+typedef struct RingIO_Attrs_tag {
+    Uint32   transportType ;
+    Uint32   ctrlPoolId ;
+    Uint32   dataPoolId ;
+    Uint32   attrPoolId ;
+    Uint32   lockPoolId ;
+    Uint32   dataBufSize ;
+    Uint32   footBufSize ;
+    Uint32   attrBufSize ;
+} RingIO_Attrs ;
+
+
+/** ============================================================================
+ *  @func   RingIO_create
+ *
+ *  @desc   Creates a ring with a data buffer of attrs->dataBufSize bytes.
+ *
+ *  @arg    procId
+ *              Accepted and ignored.
+ *  @arg    name
+ *              Name of the ring.
+ *  @arg    attrs
+ *              Creation attributes.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The ring has been created.
+ *          RINGIO_EFAILURE
+ *              Name in use, no free ring or out of memory.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_delete
+ *  ============================================================================
+ */
+Int32
+RingIO_create (Uint32 procId, const Char8 * name, RingIO_Attrs * attrs) ;
+
+/** ============================================================================
+ *  @func   RingIO_delete
+ *
+ *  @desc   Deletes a ring. Both ends must be closed.
+ *
+ *  @arg    procId
+ *              Accepted and ignored.
+ *  @arg    name
+ *              Name of the ring.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The ring has been deleted.
+ *          RINGIO_EFAILURE
+ *              Unknown name or an end is still open.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_create
+ *  ============================================================================
+ */
+Int32
+RingIO_delete (Uint32 procId, const Char8 * name) ;
+
+/** ============================================================================
+ *  @func   RingIO_open
+ *
+ *  @desc   Opens the reader or the writer end of a ring.
+ *
+ *  @arg    name
+ *              Name of the ring.
+ *  @arg    mode
+ *              RINGIO_MODE_READ or RINGIO_MODE_WRITE.
+ *  @arg    flags
+ *              RINGIO_NEED_EXACT_SIZE, the cache flags are ignored.
+ *
+ *  @ret    Handle of the end, NULL if the ring is unknown or the end is
+ *          already open.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_close
+ *  ============================================================================
+ */
+RingIO_Handle
+RingIO_open (const Char8 * name, Uint32 mode, Uint32 flags) ;
+
+/** ============================================================================
+ *  @func   RingIO_close
+ *
+ *  @desc   Closes an end of a ring. Acquired data is cancelled.
+ *
+ *  @arg    handle
+ *              Handle of the end.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The end has been closed.
+ *
+ *  @enter  handle is open.
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_open
+ *  ============================================================================
+ */
+Int32
+RingIO_close (RingIO_Handle handle) ;
+
+/** ============================================================================
+ *  @func   RingIO_acquire
+ *
+ *  @desc   Acquires up to *size bytes at the position of the end. The
+ *          writer acquires empty space, the reader valid data. Acquires stop
+ *          at the end of the buffer and, for the reader, at the next
+ *          attribute.
+ *
+ *  @arg    handle
+ *              Handle of the end.
+ *  @arg    buf
+ *              Location to receive the address of the acquired span.
+ *  @arg    size
+ *              Requested size on entry, acquired size on return.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The span has been acquired, it may be shorter than requested
+ *              when less is available.
+ *          RINGIO_EBUFWRAP, RINGIO_ENOTCONTIGUOUSDATA
+ *              Writer, reader: shortened by the end of the buffer.
+ *          RINGIO_SPENDINGATTRIBUTE
+ *              Reader: shortened by an attribute, possibly to 0 bytes.
+ *          RINGIO_EBUFFULL, RINGIO_EBUFEMPTY
+ *              Writer, reader: nothing to acquire.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_release, RingIO_cancel
+ *  ============================================================================
+ */
+Int32
+RingIO_acquire (RingIO_Handle handle, RingIO_BufPtr * buf, Uint32 * size) ;
+
+/** ============================================================================
+ *  @func   RingIO_release
+ *
+ *  @desc   Releases the first size bytes acquired by the end, and calls the
+ *          notifier of the other end if its watermark is reached.
+ *
+ *  @arg    handle
+ *              Handle of the end.
+ *  @arg    size
+ *              Bytes to release.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The bytes have been released.
+ *          RINGIO_EFAILURE
+ *              More than the acquired size.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_acquire
+ *  ============================================================================
+ */
+Int32
+RingIO_release (RingIO_Handle handle, Uint32 size) ;
+
+/** ============================================================================
+ *  @func   RingIO_cancel
+ *
+ *  @desc   Gives back all the bytes acquired by the end without releasing
+ *          them.
+ *
+ *  @arg    handle
+ *              Handle of the end.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Always.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_acquire
+ *  ============================================================================
+ */
+Int32
+RingIO_cancel (RingIO_Handle handle) ;
+
+/** ============================================================================
+ *  @func   RingIO_setAttribute
+ *
+ *  @desc   Writer: attaches a fixed attribute at the current write position,
+ *          which is the start of the span the writer holds, if any.
+ *
+ *  @arg    handle
+ *              Handle of the writer end.
+ *  @arg    dummy
+ *              Accepted and ignored.
+ *  @arg    type
+ *              Type of the attribute.
+ *  @arg    param
+ *              Parameter of the attribute.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The attribute has been set.
+ *          RINGIO_EFAILURE
+ *              No room for the attribute.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_getAttribute
+ *  ============================================================================
+ */
+Int32
+RingIO_setAttribute (RingIO_Handle handle,
+                     Uint16        dummy,
+                     Uint16        type,
+                     Uint32        param) ;
+
+/** ============================================================================
+ *  @func   RingIO_setvAttribute
+ *
+ *  @desc   Writer: attaches a variable attribute at the current write
+ *          position, as RingIO_setAttribute.
+ *
+ *  @arg    handle
+ *              Handle of the writer end.
+ *  @arg    dummy
+ *              Accepted and ignored.
+ *  @arg    type
+ *              Type of the attribute.
+ *  @arg    param
+ *              Parameter of the attribute.
+ *  @arg    pdata
+ *              Payload of the attribute.
+ *  @arg    size
+ *              Size of the payload, at most RINGIO_LOCAL_VATTR_SIZE bytes.
+ *
+ *  @ret    As RingIO_setAttribute.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_getvAttribute
+ *  ============================================================================
+ */
+Int32
+RingIO_setvAttribute (RingIO_Handle handle,
+                      Uint16        dummy,
+                      Uint16        type,
+                      Uint32        param,
+                      RingIO_BufPtr pdata,
+                      Uint32        size) ;
+
+/** ============================================================================
+ *  @func   RingIO_getAttribute
+ *
+ *  @desc   Reader: takes the fixed attribute at the current read position,
+ *          which is past the data the reader has acquired.
+ *
+ *  @arg    handle
+ *              Handle of the reader end.
+ *  @arg    type
+ *              Location to receive the type.
+ *  @arg    param
+ *              Location to receive the parameter.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The attribute has been taken.
+ *          RINGIO_SPENDINGATTRIBUTE
+ *              Taken, and another attribute follows at the same position.
+ *          RINGIO_EVARIABLEATTRIBUTE
+ *              The attribute is variable, use RingIO_getvAttribute.
+ *          RINGIO_EPENDINGDATA
+ *              Data not yet acquired precedes the next attribute.
+ *          RINGIO_EFAILURE
+ *              No attribute.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_setAttribute
+ *  ============================================================================
+ */
+Int32
+RingIO_getAttribute (RingIO_Handle handle, Uint16 * type, Uint32 * param) ;
+
+/** ============================================================================
+ *  @func   RingIO_getvAttribute
+ *
+ *  @desc   Reader: takes the fixed or variable attribute at the current read
+ *          position.
+ *
+ *  @arg    handle
+ *              Handle of the reader end.
+ *  @arg    type
+ *              Location to receive the type.
+ *  @arg    param
+ *              Location to receive the parameter.
+ *  @arg    vptr
+ *              Buffer to receive the payload.
+ *  @arg    size
+ *              Size of the buffer on entry, size of the payload on return.
+ *
+ *  @ret    As RingIO_getAttribute, RINGIO_EVARIABLEATTRIBUTE meaning that
+ *          the buffer is too small for the payload.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_setvAttribute
+ *  ============================================================================
+ */
+Int32
+RingIO_getvAttribute (RingIO_Handle handle,
+                      Uint16 *      type,
+                      Uint32 *      param,
+                      RingIO_BufPtr vptr,
+                      Uint32 *      size) ;
+
+/** ============================================================================
+ *  @func   RingIO_setNotifier
+ *
+ *  @desc   Sets the notifier of an end. It is called when the other end
+ *          releases and the watermark is reached (valid bytes for the
+ *          reader, empty bytes for the writer), and for every message the
+ *          other end sends. RINGIO_NOTIFICATION_ONCE notifiers are rearmed
+ *          by a failed acquire.
+ *
+ *  @arg    handle
+ *              Handle of the end.
+ *  @arg    type
+ *              RINGIO_NOTIFICATION_NONE, _ALWAYS or _ONCE.
+ *  @arg    watermark
+ *              Watermark in bytes.
+ *  @arg    fxn
+ *              Notifier.
+ *  @arg    param
+ *              Parameter passed to the notifier.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Always.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_sendNotify
+ *  ============================================================================
+ */
+Int32
+RingIO_setNotifier (RingIO_Handle      handle,
+                    RingIO_NotifyType  type,
+                    Uint32             watermark,
+                    RingIO_NotifyFunc  fxn,
+                    RingIO_NotifyParam param) ;
+
+/** ============================================================================
+ *  @func   RingIO_sendNotify
+ *
+ *  @desc   Calls the notifier of the other end with a message.
+ *
+ *  @arg    handle
+ *              Handle of the end.
+ *  @arg    msg
+ *              Message.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The notifier has been called.
+ *          RINGIO_EFAILURE
+ *              The other end is not open or has no notifier.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RingIO_setNotifier
+ *  ============================================================================
+ */
+Int32
+RingIO_sendNotify (RingIO_Handle handle, RingIO_NotifyMsg msg) ;
+
+/** ============================================================================
+ *  @func   RingIO_getValidSize, RingIO_getEmptySize
+ *
+ *  @desc   Bytes written and not yet acquired by the reader, and bytes the
+ *          writer can still acquire.
+ *
+ *  @arg    handle
+ *              Handle of either end.
+ *
+ *  @ret    Size in bytes.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+Uint32
+RingIO_getValidSize (RingIO_Handle handle) ;
+
+Uint32
+RingIO_getEmptySize (RingIO_Handle handle) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (RING_IO_LOCAL_) */
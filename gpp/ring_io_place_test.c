@@ -0,0 +1,390 @@
+/** ============================================================================
+ *  @file   ring_io_place_test.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   Host test of the channel placement of the RING_IO sample on
+ *          several DSPs. Each simulated DSP runs in its own thread and
+ *          builds the RingIO names of the channels it serves with
+ *          RING_IO_placeServes and RING_IO_placeName, as TSKRING_IO_create1
+ *          and 2 do on the target. The names are checked for collisions
+ *          across the DSPs. Built with RING_IO_LOCAL defined and linked with
+ *          ../ring_io_place.c and the pthread library; the exit status is 0
+ *          when all checks pass.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_protocol.h>
+#include <ring_io_place.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  PLACE_TEST_DSPS, PLACE_TEST_CHANNELS
+ *
+ *  @desc   Largest number of simulated DSPs and of channels of a setup.
+ *  ============================================================================
+ */
+#define PLACE_TEST_DSPS         4u
+#define PLACE_TEST_CHANNELS     4u
+
+/** ============================================================================
+ *  @name   PLACE_TEST_Setup
+ *
+ *  @desc   One placement setup: the DSPs running the image and the channels.
+ *
+ *  @field  title
+ *              Name of the setup, printed with the results.
+ *  @field  numDsps
+ *              Number of DSPs, each run by a thread.
+ *  @field  procIds
+ *              Processor ID of each DSP.
+ *  @field  numChannels
+ *              Number of channels.
+ *  @field  places
+ *              Placement of each channel.
+ *  @field  bases
+ *              Base name of the input RingIO of each channel.
+ *  ============================================================================
+ */
+typedef struct PLACE_TEST_Setup_tag {
+    const Char8 * title ;
+    Uint32        numDsps ;
+    Uint32        procIds [PLACE_TEST_DSPS] ;
+    Uint32        numChannels ;
+    Uint32        places [PLACE_TEST_CHANNELS] ;
+    const Char8 * bases [PLACE_TEST_CHANNELS] ;
+} PLACE_TEST_Setup ;
+
+/** ============================================================================
+ *  @name   PLACE_TEST_Dsp
+ *
+ *  @desc   State of a simulated DSP. Only its own thread writes it until the
+ *          thread is joined.
+ *
+ *  @field  setup
+ *              Setup being run.
+ *  @field  procId
+ *              Processor ID of the DSP.
+ *  @field  serves
+ *              TRUE for each channel the DSP serves.
+ *  @field  names
+ *              Name of the input RingIO of each channel served.
+ *  @field  status
+ *              SYS_OK, or the status of the first failing RING_IO_placeName.
+ *  ============================================================================
+ */
+typedef struct PLACE_TEST_Dsp_tag {
+    const PLACE_TEST_Setup * setup ;
+    Uint32                   procId ;
+    Bool                     serves [PLACE_TEST_CHANNELS] ;
+    Char                     names [PLACE_TEST_CHANNELS][RING_IO_NAME_LEN] ;
+    Int                      status ;
+} PLACE_TEST_Dsp ;
+
+/** ============================================================================
+ *  @name   PLACE_TEST_setups
+ *
+ *  @desc   Setups run by the test: a single DSP with local channels, and
+ *          four DSPs sharing channels placed on each DSP and on fixed IDs.
+ *  ============================================================================
+ */
+static const PLACE_TEST_Setup PLACE_TEST_setups [] = {
+    {
+        "single DSP, local channels",
+        1u, { 0u },
+        2u, { RING_IO_PLACE_LOCAL, RING_IO_PLACE_LOCAL },
+            { "RINGIO1", "RINGIO3" }
+    },
+    {
+        "four DSPs, each and fixed channels",
+        4u, { 0u, 1u, 2u, 12u },
+        4u, { RING_IO_PLACE_EACH, RING_IO_PLACE_EACH, 1u, 12u },
+            { "RINGIO1", "RINGIO3", "RINGIO5", "RINGIO7" }
+    }
+} ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   PLACE_TEST_dspMain
+ *
+ *  @desc   Thread of a simulated DSP: builds the names of the channels the
+ *          DSP serves.
+ *
+ *  @arg    arg
+ *              PLACE_TEST_Dsp of the DSP.
+ *
+ *  @ret    NULL
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_placeServes, RING_IO_placeName
+ *  ----------------------------------------------------------------------------
+ */
+static
+Pvoid
+PLACE_TEST_dspMain (Pvoid arg) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   PLACE_TEST_check
+ *
+ *  @desc   Runs a setup with one thread per DSP and checks the names: a
+ *          local channel keeps its base name, a channel placed on each DSP
+ *          is served by all of them, a fixed channel only by its DSP, and
+ *          no two served channels share a name.
+ *
+ *  @arg    setup
+ *              Setup to run.
+ *
+ *  @ret    Number of failed checks.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    PLACE_TEST_dspMain
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+PLACE_TEST_check (const PLACE_TEST_Setup * setup) ;
+
+
+/** ============================================================================
+ *  @func   main
+ *
+ *  @desc   Runs every setup and checks the RingIO name length limit.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+int
+main (int argc, char ** argv)
+{
+    Uint32 failures = 0 ;
+    Char   name [RING_IO_NAME_LEN] ;
+    Char8  longBase [RING_IO_NAME_LEN] ;
+    Uint32 numSetups ;
+    Uint32 i ;
+
+    (Void) argc ;
+    (Void) argv ;
+
+    numSetups = sizeof (PLACE_TEST_setups) / sizeof (PLACE_TEST_setups [0]) ;
+    for (i = 0 ; i < numSetups ; i++) {
+        failures += PLACE_TEST_check (&PLACE_TEST_setups [i]) ;
+    }
+
+    /* A base name leaving no room for the processor ID is refused */
+    memset (longBase, 'R', RING_IO_NAME_LEN - 3u) ;
+    longBase [RING_IO_NAME_LEN - 3u] = '\0' ;
+    if (RING_IO_placeName (name, longBase, RING_IO_PLACE_LOCAL, 0u) != SYS_OK) {
+        printf ("FAIL long local name refused\n") ;
+        failures++ ;
+    }
+    if (RING_IO_placeName (name, longBase, RING_IO_PLACE_EACH, 65535u)
+        != SYS_EINVAL) {
+        printf ("FAIL long placed name accepted\n") ;
+        failures++ ;
+    }
+
+    printf ("ring_io_place_test: %u failure(s)\n", failures) ;
+
+    return (failures == 0) ? 0 : 1 ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   PLACE_TEST_dspMain
+ *
+ *  @desc   Thread of a simulated DSP.
+ *
+ *  @modif  The PLACE_TEST_Dsp of the DSP.
+ *  ----------------------------------------------------------------------------
+ */
+static
+Pvoid
+PLACE_TEST_dspMain (Pvoid arg)
+{
+    PLACE_TEST_Dsp *         dsp   = (PLACE_TEST_Dsp *) arg ;
+    const PLACE_TEST_Setup * setup = dsp->setup ;
+    Int                      status ;
+    Uint32                   c ;
+
+    dsp->status = SYS_OK ;
+    for (c = 0 ; c < setup->numChannels ; c++) {
+        dsp->serves [c] = RING_IO_placeServes (setup->places [c],
+                                               dsp->procId) ;
+        if (dsp->serves [c] == TRUE) {
+            status = RING_IO_placeName (dsp->names [c],
+                                        setup->bases [c],
+                                        setup->places [c],
+                                        dsp->procId) ;
+            if ((status != SYS_OK) && (dsp->status == SYS_OK)) {
+                dsp->status = status ;
+            }
+        }
+    }
+
+    return (NULL) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   PLACE_TEST_check
+ *
+ *  @desc   Runs a setup and checks the names.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+PLACE_TEST_check (const PLACE_TEST_Setup * setup)
+{
+    PLACE_TEST_Dsp dsps [PLACE_TEST_DSPS] ;
+    pthread_t      threads [PLACE_TEST_DSPS] ;
+    Bool           started [PLACE_TEST_DSPS] ;
+    Uint32         failures = 0 ;
+    Uint32         place ;
+    Uint32         served ;
+    Uint32         c ;
+    Uint32         d ;
+    Uint32         c2 ;
+    Uint32         d2 ;
+
+    memset (dsps, 0, sizeof (dsps)) ;
+    for (d = 0 ; d < setup->numDsps ; d++) {
+        dsps [d].setup  = setup ;
+        dsps [d].procId = setup->procIds [d] ;
+        started [d] = (pthread_create (&threads [d],
+                                       NULL,
+                                       &PLACE_TEST_dspMain,
+                                       &dsps [d]) == 0) ;
+        if (started [d] == FALSE) {
+            printf ("FAIL %s: thread of DSP %u not started\n",
+                    setup->title, dsps [d].procId) ;
+            failures++ ;
+        }
+    }
+    for (d = 0 ; d < setup->numDsps ; d++) {
+        if (started [d] == TRUE) {
+            pthread_join (threads [d], NULL) ;
+        }
+        if (dsps [d].status != SYS_OK) {
+            printf ("FAIL %s: DSP %u name status %d\n",
+                    setup->title, dsps [d].procId, dsps [d].status) ;
+            failures++ ;
+        }
+    }
+
+    for (c = 0 ; c < setup->numChannels ; c++) {
+        place  = setup->places [c] ;
+        served = 0 ;
+        for (d = 0 ; d < setup->numDsps ; d++) {
+            if (dsps [d].serves [c] == TRUE) {
+                served++ ;
+                printf ("%s: DSP %u serves %s\n",
+                        setup->title, dsps [d].procId, dsps [d].names [c]) ;
+                if (   (place == RING_IO_PLACE_LOCAL)
+                    && (strcmp (dsps [d].names [c], setup->bases [c]) != 0)) {
+                    printf ("FAIL %s: local name %s\n",
+                            setup->title, dsps [d].names [c]) ;
+                    failures++ ;
+                }
+            }
+        }
+
+        if (   (   (place == RING_IO_PLACE_LOCAL)
+                || (place == RING_IO_PLACE_EACH))
+            && (served != setup->numDsps)) {
+            printf ("FAIL %s: channel %u served by %u DSP(s)\n",
+                    setup->title, c, served) ;
+            failures++ ;
+        }
+        else if (   (place != RING_IO_PLACE_LOCAL)
+                 && (place != RING_IO_PLACE_EACH)
+                 && (served != 1u)) {
+            printf ("FAIL %s: fixed channel %u served by %u DSP(s)\n",
+                    setup->title, c, served) ;
+            failures++ ;
+        }
+    }
+
+    /* Every RingIO name in use must be unique across the DSPs */
+    for (d = 0 ; d < setup->numDsps ; d++) {
+        for (c = 0 ; c < setup->numChannels ; c++) {
+            for (d2 = d ;
+                 (dsps [d].serves [c] == TRUE) && (d2 < setup->numDsps) ;
+                 d2++) {
+                for (c2 = (d2 == d) ? (c + 1u) : 0 ;
+                     c2 < setup->numChannels ;
+                     c2++) {
+                    if (   (dsps [d2].serves [c2] == TRUE)
+                        && (strcmp (dsps [d].names [c],
+                                    dsps [d2].names [c2]) == 0)) {
+                        printf ("FAIL %s: %s used by DSP %u and DSP %u\n",
+                                setup->title,
+                                dsps [d].names [c],
+                                dsps [d].procId,
+                                dsps [d2].procId) ;
+                        failures++ ;
+                    }
+                }
+            }
+        }
+    }
+
+    return (failures) ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
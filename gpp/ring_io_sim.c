@@ -0,0 +1,1556 @@
+/** ============================================================================
+ *  @file   ring_io_sim.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   Discrete-event capacity model of the RING_IO sample. Built with
+ *          RING_IO_SIM_MAIN defined, it is a host program taking name=value
+ *          overrides of the default configuration and printing the prediction.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_sim.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_SIM_WRITER, RING_IO_SIM_TASK, RING_IO_SIM_READER
+ *
+ *  @desc   Kinds of actor: the GPP writer of the input RingIO, the DSP task
+ *          and the GPP reader of the output RingIO of a channel. Actor
+ *          3c+k is of kind k on channel c.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_WRITER      0u
+#define RING_IO_SIM_TASK        1u
+#define RING_IO_SIM_READER      2u
+#define RING_IO_SIM_ACTORS      (3u * RING_IO_SIM_CHANNELS)
+
+/** ============================================================================
+ *  @const  RING_IO_SIM_BEGIN ... RING_IO_SIM_DONE
+ *
+ *  @desc   States of an actor. A writer goes through WBEGIN, WRITE and
+ *          WEND for each frame, WEND only without packing, a reader stays
+ *          in READ, and the DSP task goes through all of them.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_BEGIN       0u
+#define RING_IO_SIM_READ        1u
+#define RING_IO_SIM_STAGES      2u
+#define RING_IO_SIM_WBEGIN      3u
+#define RING_IO_SIM_WRITE       4u
+#define RING_IO_SIM_WEND        5u
+#define RING_IO_SIM_DONE        6u
+
+/** ============================================================================
+ *  @const  RING_IO_SIM_START ... RING_IO_SIM_NONE
+ *
+ *  @desc   What a reader takes at its read position: a fixed start
+ *          attribute, a packed start and size, a size attribute, a fixed
+ *          end attribute, a data span, or nothing yet.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_START       0u
+#define RING_IO_SIM_PSTART      1u
+#define RING_IO_SIM_SIZE        2u
+#define RING_IO_SIM_END         3u
+#define RING_IO_SIM_DATA        4u
+#define RING_IO_SIM_NONE        5u
+
+/** ============================================================================
+ *  @const  RING_IO_SIM_NEVER, RING_IO_SIM_IDLE
+ *
+ *  @desc   Wake time of an actor waiting for another one, and CPU owner
+ *          value of an idle DSP.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_NEVER       (-1.0)
+#define RING_IO_SIM_IDLE        RING_IO_SIM_ACTORS
+
+
+/** ============================================================================
+ *  @name   RING_IO_SimRing
+ *
+ *  @desc   State of a modelled RingIO. Positions count bytes from the
+ *          start of the run.
+ *
+ *  @field  size
+ *              Data buffer size.
+ *  @field  fill
+ *              Bytes released by the writer and not yet by the reader.
+ *  @field  readPos
+ *              Position of the reader.
+ *  @field  writePos
+ *              Position of the released data.
+ *  @field  attrPos
+ *              Positions of the attributes held, a circular queue.
+ *  @field  attrKind
+ *              Kinds of the attributes held.
+ *  @field  attrHead
+ *              First attribute of the queue.
+ *  @field  attrCount
+ *              Attributes held.
+ *  @field  writer, reader
+ *              Actors at the two ends.
+ *  @field  fillSince
+ *              Time of the last fill change.
+ *  @field  fillArea
+ *              Integral of the fill over time.
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimRing_tag {
+    Uint32    size ;
+    Uint32    fill ;
+    Uint32    readPos ;
+    Uint32    writePos ;
+    Uint32    attrPos [RING_IO_SIM_ATTRS] ;
+    Uint8     attrKind [RING_IO_SIM_ATTRS] ;
+    Uint32    attrHead ;
+    Uint32    attrCount ;
+    Uint32    writer ;
+    Uint32    reader ;
+    Real64    fillSince ;
+    Real64    fillArea ;
+} RING_IO_SimRing ;
+
+/** ============================================================================
+ *  @name   RING_IO_SimActor
+ *
+ *  @desc   State of an actor. The effect of a RingIO call on the rings is
+ *          applied when the call completes, at the next step of the actor.
+ *
+ *  @field  kind
+ *              RING_IO_SIM_WRITER, RING_IO_SIM_TASK or RING_IO_SIM_READER.
+ *  @field  channel
+ *              Channel of the actor.
+ *  @field  state
+ *              Current state.
+ *  @field  wake
+ *              Time of the next step, RING_IO_SIM_NEVER while waiting.
+ *  @field  waiting
+ *              TRUE while waiting for room or data in a RingIO.
+ *  @field  yield
+ *              TRUE if the DSP task gives up the CPU at its next step.
+ *  @field  packStart
+ *              TRUE while the start of the frame is to be packed with the
+ *              first size.
+ *  @field  frame
+ *              Current frame.
+ *  @field  left
+ *              Bytes of the frame left to read or write.
+ *  @field  pendRing
+ *              RingIO of the call in progress.
+ *  @field  pendAttr
+ *              Attribute the call sets, RING_IO_SIM_NONE for none.
+ *  @field  pendBytes
+ *              Bytes the call releases.
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimActor_tag {
+    Uint32    kind ;
+    Uint32    channel ;
+    Uint32    state ;
+    Real64    wake ;
+    Bool      waiting ;
+    Bool      yield ;
+    Bool      packStart ;
+    Uint32    frame ;
+    Uint32    left ;
+    Uint32    pendRing ;
+    Uint32    pendAttr ;
+    Uint32    pendBytes ;
+} RING_IO_SimActor ;
+
+/** ============================================================================
+ *  @name   RING_IO_Sim
+ *
+ *  @desc   State of a run.
+ *
+ *  @field  config
+ *              Configuration run.
+ *  @field  result
+ *              Prediction being built.
+ *  @field  actor
+ *              The actors.
+ *  @field  ring
+ *              The RingIOs.
+ *  @field  now
+ *              Virtual time in DSP cycles.
+ *  @field  cpuOwner
+ *              DSP task holding the CPU, RING_IO_SIM_IDLE for none.
+ *  @field  cpuSince
+ *              Time the CPU was taken.
+ *  @field  cpuBusy
+ *              Cycles the CPU was held.
+ *  @field  ready
+ *              DSP tasks waiting for the CPU, in order.
+ *  @field  readyCount
+ *              Number of tasks in ready.
+ *  @field  arrival
+ *              Per channel, arrival time of each frame at the GPP writer.
+ *  @field  latency
+ *              Per channel, latency of each delivered frame.
+ *  ============================================================================
+ */
+typedef struct RING_IO_Sim_tag {
+    const RING_IO_SimConfig * config ;
+    RING_IO_SimResult *       result ;
+    RING_IO_SimActor          actor [RING_IO_SIM_ACTORS] ;
+    RING_IO_SimRing           ring [RING_IO_SIM_RINGS] ;
+    Real64                    now ;
+    Uint32                    cpuOwner ;
+    Real64                    cpuSince ;
+    Real64                    cpuBusy ;
+    Uint32                    ready [RING_IO_SIM_ACTORS] ;
+    Uint32                    readyCount ;
+    Real64 *                  arrival [RING_IO_SIM_CHANNELS] ;
+    Real64 *                  latency [RING_IO_SIM_CHANNELS] ;
+} RING_IO_Sim ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simWriter
+ *
+ *  @desc   Steps the GPP writer of a channel.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *
+ *  @ret    None
+ *
+ *  @enter  The actor is due.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simRun
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simWriter (RING_IO_Sim * sim, Uint32 index) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simTask
+ *
+ *  @desc   Steps the DSP task of a channel, once it holds the CPU.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *
+ *  @ret    None
+ *
+ *  @enter  The actor is due.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simRun
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simTask (RING_IO_Sim * sim, Uint32 index) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simReader
+ *
+ *  @desc   Steps the GPP reader of a channel.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *
+ *  @ret    None
+ *
+ *  @enter  The actor is due.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simRun
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simReader (RING_IO_Sim * sim, Uint32 index) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simComplete
+ *
+ *  @desc   Applies the effect of the completed call of an actor to its
+ *          RingIO and wakes the actor at the other end.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  No call of the actor is in progress.
+ *
+ *  @see    RING_IO_simPut, RING_IO_simTake
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simComplete (RING_IO_Sim * sim, Uint32 index) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simPut
+ *
+ *  @desc   Starts the next writer call of a frame: start attribute, span
+ *          with its size attribute, or end attribute, as the state of the
+ *          actor says.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *  @arg    ring
+ *              Index of the RingIO written.
+ *  @arg    costs
+ *              Costs of the side of the actor.
+ *  @arg    chunk
+ *              Largest span.
+ *
+ *  @ret    Cycles of the call, RING_IO_SIM_NEVER if the RingIO has no
+ *          room and the actor now waits.
+ *
+ *  @enter  The actor is in RING_IO_SIM_WBEGIN, RING_IO_SIM_WRITE or
+ *          RING_IO_SIM_WEND.
+ *
+ *  @leave  The state moves on once the call is started.
+ *
+ *  @see    RING_IO_simComplete
+ *  ----------------------------------------------------------------------------
+ */
+static
+Real64
+RING_IO_simPut (RING_IO_Sim *            sim,
+                Uint32                   index,
+                Uint32                   ring,
+                const RING_IO_SimCosts * costs,
+                Uint32                   chunk) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simEnd
+ *
+ *  @desc   Counts a span taken by a reader against the frame when the
+ *          attributes are packed, as the end of such a frame comes in the
+ *          record of its last span.
+ *
+ *  @arg    actor
+ *              The reader, DSP task or GPP reader.
+ *  @arg    channel
+ *              Channel of the actor.
+ *  @arg    taken
+ *              Kind of what the reader took.
+ *
+ *  @ret    RING_IO_SIM_END for the last span of a packed frame, else
+ *          taken.
+ *
+ *  @enter  actor->left holds the bytes of the frame left to read.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simTake
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+RING_IO_simEnd (RING_IO_SimActor *         actor,
+                const RING_IO_SimChannel * channel,
+                Uint32                     taken) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simTake
+ *
+ *  @desc   Starts the next reader call: takes the attribute at the read
+ *          position, or acquires a span of at most chunk bytes up to the
+ *          next attribute.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *  @arg    ring
+ *              Index of the RingIO read.
+ *  @arg    costs
+ *              Costs of the side of the actor.
+ *  @arg    chunk
+ *              Largest span.
+ *  @arg    cycles
+ *              Location to receive the cycles of the call.
+ *
+ *  @ret    Kind of what was taken, RING_IO_SIM_NONE if the RingIO is
+ *          empty and the actor now waits.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simComplete
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+RING_IO_simTake (RING_IO_Sim *            sim,
+                 Uint32                   index,
+                 Uint32                   ring,
+                 const RING_IO_SimCosts * costs,
+                 Uint32                   chunk,
+                 Real64 *                 cycles) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simFill
+ *
+ *  @desc   Changes the fill of a RingIO, keeping its statistics.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    ring
+ *              Index of the RingIO.
+ *  @arg    fill
+ *              New fill.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_SimRingStats
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simFill (RING_IO_Sim * sim, Uint32 ring, Uint32 fill) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simWake
+ *
+ *  @desc   Wakes an actor waiting on a RingIO, after the notification
+ *          latency.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simWait
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simWake (RING_IO_Sim * sim, Uint32 index) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simWait
+ *
+ *  @desc   Makes an actor wait on a RingIO. A DSP task gives up the CPU.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the actor.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simWake
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simWait (RING_IO_Sim * sim, Uint32 index) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simRelease
+ *
+ *  @desc   Gives up the DSP CPU held by a task and hands it to the first
+ *          ready task. With yield set, the task goes to the back of the
+ *          ready tasks first.
+ *
+ *  @arg    sim
+ *              The run.
+ *  @arg    index
+ *              Index of the task.
+ *  @arg    yield
+ *              TRUE if the task stays ready.
+ *
+ *  @ret    None
+ *
+ *  @enter  The task holds the CPU.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simTask
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simRelease (RING_IO_Sim * sim, Uint32 index, Bool yield) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simCopy
+ *
+ *  @desc   Cycles of a copy.
+ *
+ *  @arg    costs
+ *              Costs of the side copying.
+ *  @arg    size
+ *              Bytes copied.
+ *
+ *  @ret    Cycles of the copy.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_SimCosts
+ *  ----------------------------------------------------------------------------
+ */
+static
+Real64
+RING_IO_simCopy (const RING_IO_SimCosts * costs, Uint32 size) ;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simCompare
+ *
+ *  @desc   qsort comparison of two latencies.
+ *
+ *  @arg    a, b
+ *              The latencies.
+ *
+ *  @ret    Negative, zero or positive as a is below, equal to or above b.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simRun
+ *  ----------------------------------------------------------------------------
+ */
+static
+int
+RING_IO_simCompare (const void * a, const void * b) ;
+
+
+/** ============================================================================
+ *  @func   RING_IO_simDefaults
+ *
+ *  @desc   Fills a configuration with the sample defaults.
+ *
+ *  @modif  config
+ *  ============================================================================
+ */
+Void
+RING_IO_simDefaults (RING_IO_SimConfig * config)
+{
+    RING_IO_SimChannel * channel ;
+    Uint32               i ;
+
+    memset (config, 0, sizeof (RING_IO_SimConfig)) ;
+
+    for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+        channel = &config->channel [i] ;
+        channel->frames      = 1000u ;
+        channel->frameSize   = 1024u << i ;
+        channel->framePeriod = 0u ;
+        channel->inRingSize  = 10240u ;
+        channel->outRingSize = 10240u ;
+        channel->gppChunk    = 1024u ;
+        channel->readSize    = channel->frameSize ;
+        channel->writeSize   = 1024u ;
+        channel->stageFixed  = 200u ;
+        channel->stagePerKB  = 2000u ;
+        channel->packAttrs   = FALSE ;
+    }
+
+    /* Placeholders: replace with the "BENCH" figures of the target */
+    config->dsp.acquire       = 400u ;
+    config->dsp.release       = 300u ;
+    config->dsp.setAttribute  = 250u ;
+    config->dsp.setvAttribute = 300u ;
+    config->dsp.getAttribute  = 250u ;
+    config->dsp.getvAttribute = 300u ;
+    config->dsp.sendNotify    = 1500u ;
+    config->dsp.copyPerKB     = 600u ;
+    config->gpp               = config->dsp ;
+    config->notifyLatency     = 20000u ;
+    config->cpuMHz            = 600u ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_simRun
+ *
+ *  @desc   Runs a configuration in virtual time.
+ *
+ *  @modif  result
+ *  ============================================================================
+ */
+Int32
+RING_IO_simRun (const RING_IO_SimConfig * config, RING_IO_SimResult * result)
+{
+    Int32                      status = RINGIO_SUCCESS ;
+    RING_IO_Sim *              sim ;
+    RING_IO_SimActor *         actor ;
+    RING_IO_SimRing *          ring ;
+    const RING_IO_SimChannel * channel ;
+    RING_IO_SimChannelStats *  stats ;
+    Uint32                     next ;
+    Uint32                     frames ;
+    Uint32                     i ;
+
+    memset (result, 0, sizeof (RING_IO_SimResult)) ;
+
+    sim = (RING_IO_Sim *) calloc (1u, sizeof (RING_IO_Sim)) ;
+    if ((sim == NULL) || (config->cpuMHz == 0u)) {
+        status = RINGIO_EFAILURE ;
+    }
+
+    for (i = 0u ; (i < RING_IO_SIM_CHANNELS) && (status == RINGIO_SUCCESS) ;
+         i++) {
+        channel = &config->channel [i] ;
+        if (   (channel->frames != 0u)
+            && (   (channel->frameSize == 0u)
+                || (channel->inRingSize == 0u)
+                || (channel->outRingSize == 0u)
+                || (channel->gppChunk == 0u)
+                || (channel->readSize == 0u)
+                || (channel->writeSize == 0u))) {
+            status = RINGIO_EFAILURE ;
+        }
+        else {
+            frames = (channel->frames != 0u) ? channel->frames : 1u ;
+            sim->arrival [i] = (Real64 *) calloc (frames, sizeof (Real64)) ;
+            sim->latency [i] = (Real64 *) calloc (frames, sizeof (Real64)) ;
+            if ((sim->arrival [i] == NULL) || (sim->latency [i] == NULL)) {
+                status = RINGIO_EFAILURE ;
+            }
+        }
+    }
+
+    if (status == RINGIO_SUCCESS) {
+        sim->config   = config ;
+        sim->result   = result ;
+        sim->cpuOwner = RING_IO_SIM_IDLE ;
+
+        for (i = 0u ; i < RING_IO_SIM_ACTORS ; i++) {
+            actor = &sim->actor [i] ;
+            actor->kind     = i % 3u ;
+            actor->channel  = i / 3u ;
+            actor->pendAttr = RING_IO_SIM_NONE ;
+            channel = &config->channel [actor->channel] ;
+            if (channel->frames == 0u) {
+                actor->state = RING_IO_SIM_DONE ;
+                actor->wake  = RING_IO_SIM_NEVER ;
+            }
+            else if (actor->kind == RING_IO_SIM_WRITER) {
+                actor->state = RING_IO_SIM_WBEGIN ;
+            }
+            else if (actor->kind == RING_IO_SIM_TASK) {
+                actor->state = RING_IO_SIM_BEGIN ;
+            }
+            else {
+                actor->state = RING_IO_SIM_READ ;
+            }
+        }
+
+        for (i = 0u ; i < RING_IO_SIM_RINGS ; i++) {
+            ring    = &sim->ring [i] ;
+            channel = &config->channel [i / 2u] ;
+            ring->size   = ((i % 2u) == 0u) ? channel->inRingSize
+                                            : channel->outRingSize ;
+            ring->writer = (3u * (i / 2u)) + (i % 2u) ;
+            ring->reader = ring->writer + 1u ;
+        }
+
+        /* Run the due actor until none is left */
+        do {
+            next = RING_IO_SIM_ACTORS ;
+            for (i = 0u ; i < RING_IO_SIM_ACTORS ; i++) {
+                actor = &sim->actor [i] ;
+                if (   (actor->wake >= 0.0)
+                    && (   (next == RING_IO_SIM_ACTORS)
+                        || (actor->wake < sim->actor [next].wake))) {
+                    next = i ;
+                }
+            }
+
+            if (next != RING_IO_SIM_ACTORS) {
+                actor    = &sim->actor [next] ;
+                sim->now = actor->wake ;
+                if (actor->kind == RING_IO_SIM_WRITER) {
+                    RING_IO_simWriter (sim, next) ;
+                }
+                else if (actor->kind == RING_IO_SIM_TASK) {
+                    RING_IO_simTask (sim, next) ;
+                }
+                else {
+                    RING_IO_simReader (sim, next) ;
+                }
+            }
+        } while (next != RING_IO_SIM_ACTORS) ;
+
+        /* Left waiting with frames to go: the configuration stalls */
+        for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+            if (result->channel [i].frames < config->channel [i].frames) {
+                status = RINGIO_EFAILURE ;
+            }
+        }
+
+        result->cycles = sim->now ;
+        if (sim->now > 0.0) {
+            result->dspLoad = sim->cpuBusy / sim->now ;
+        }
+
+        for (i = 0u ; i < RING_IO_SIM_RINGS ; i++) {
+            RING_IO_simFill (sim, i, sim->ring [i].fill) ;
+            if (sim->now > 0.0) {
+                result->ring [i].meanFill = sim->ring [i].fillArea / sim->now ;
+            }
+        }
+
+        for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+            stats  = &result->channel [i] ;
+            frames = stats->frames ;
+            if ((frames != 0u) && (sim->now > 0.0)) {
+                stats->framesPerSec =   ((Real64) frames * config->cpuMHz
+                                         * 1.0e6)
+                                      / sim->now ;
+                stats->MBps         =   ((Real64) frames
+                                         * config->channel [i].frameSize
+                                         * config->cpuMHz)
+                                      / sim->now ;
+
+                qsort (sim->latency [i], frames, sizeof (Real64),
+                       &RING_IO_simCompare) ;
+                for (next = 0u ; next < frames ; next++) {
+                    stats->latencyMean += sim->latency [i][next] ;
+                }
+                stats->latencyMean /= (Real64) frames * config->cpuMHz ;
+                stats->latencyP50 =   sim->latency [i][(frames - 1u) / 2u]
+                                    / config->cpuMHz ;
+                stats->latencyP90 =   sim->latency [i][  ((frames - 1u) * 9u)
+                                                       / 10u]
+                                    / config->cpuMHz ;
+                stats->latencyP99 =   sim->latency [i][  ((frames - 1u) * 99u)
+                                                       / 100u]
+                                    / config->cpuMHz ;
+                stats->latencyMax =   sim->latency [i][frames - 1u]
+                                    / config->cpuMHz ;
+            }
+        }
+    }
+
+    if (sim != NULL) {
+        for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+            free (sim->arrival [i]) ;
+            free (sim->latency [i]) ;
+        }
+        free (sim) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   RING_IO_simReport
+ *
+ *  @desc   Prints a prediction to the standard output.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Void
+RING_IO_simReport (const RING_IO_SimConfig * config,
+                   const RING_IO_SimResult * result)
+{
+    const RING_IO_SimChannelStats * stats ;
+    const RING_IO_SimRingStats *    ring ;
+    Uint32                          i ;
+
+    printf ("run: %.0f cycles, %.3f ms, DSP load %.1f %%\n",
+            result->cycles,
+            result->cycles / (config->cpuMHz * 1000.0),
+            result->dspLoad * 100.0) ;
+
+    for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+        stats = &result->channel [i] ;
+        printf ("channel %u: %u frames, %.1f frames/s, %.2f MB/s\n",
+                i + 1u,
+                stats->frames,
+                stats->framesPerSec,
+                stats->MBps) ;
+        printf ("  latency us: mean %.1f p50 %.1f p90 %.1f p99 %.1f "
+                "max %.1f\n",
+                stats->latencyMean,
+                stats->latencyP50,
+                stats->latencyP90,
+                stats->latencyP99,
+                stats->latencyMax) ;
+    }
+
+    for (i = 0u ; i < RING_IO_SIM_RINGS ; i++) {
+        ring = &result->ring [i] ;
+        printf ("ring %u (channel %u %s, %u bytes): fill peak %u mean %.0f, "
+                "attrs peak %u, waits full %u empty %u\n",
+                i,
+                (i / 2u) + 1u,
+                ((i % 2u) == 0u) ? "in" : "out",
+                ((i % 2u) == 0u) ? config->channel [i / 2u].inRingSize
+                                 : config->channel [i / 2u].outRingSize,
+                ring->peakFill,
+                ring->meanFill,
+                ring->peakAttrs,
+                ring->fullWaits,
+                ring->emptyWaits) ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simWriter
+ *
+ *  @desc   Steps the GPP writer of a channel.
+ *
+ *  @modif  sim
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simWriter (RING_IO_Sim * sim, Uint32 index)
+{
+    RING_IO_SimActor *         actor   = &sim->actor [index] ;
+    const RING_IO_SimChannel * channel ;
+    Real64                     arrival ;
+    Real64                     cycles ;
+    Bool                       begin ;
+
+    channel = &sim->config->channel [actor->channel] ;
+    RING_IO_simComplete (sim, index) ;
+
+    if ((actor->state == RING_IO_SIM_WBEGIN)
+        && (actor->frame == channel->frames)) {
+        actor->state = RING_IO_SIM_DONE ;
+        actor->wake  = RING_IO_SIM_NEVER ;
+    }
+    else {
+        /* A late frame counts from its due time */
+        begin   = (actor->state == RING_IO_SIM_WBEGIN) ;
+        arrival = (Real64) actor->frame * channel->framePeriod ;
+        if ((begin == TRUE) && (arrival > sim->now)) {
+            actor->wake = arrival ;
+        }
+        else {
+            cycles = RING_IO_simPut (sim,
+                                     index,
+                                     2u * actor->channel,
+                                     &sim->config->gpp,
+                                     channel->gppChunk) ;
+            if (cycles >= 0.0) {
+                if (begin == TRUE) {
+                    sim->arrival [actor->channel][actor->frame] =
+                                (channel->framePeriod != 0u) ? arrival
+                                                             : sim->now ;
+                }
+                actor->wake = sim->now + cycles ;
+            }
+        }
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simTask
+ *
+ *  @desc   Steps the DSP task of a channel.
+ *
+ *  @modif  sim
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simTask (RING_IO_Sim * sim, Uint32 index)
+{
+    RING_IO_SimActor *         actor   = &sim->actor [index] ;
+    const RING_IO_SimChannel * channel ;
+    Real64                     cycles  = 0.0 ;
+    Uint32                     taken ;
+
+    channel = &sim->config->channel [actor->channel] ;
+    RING_IO_simComplete (sim, index) ;
+
+    /* TSK_yield at the end of a frame */
+    if (actor->yield == TRUE) {
+        actor->yield = FALSE ;
+        RING_IO_simRelease (sim, index, TRUE) ;
+        return ;
+    }
+
+    if (sim->cpuOwner == RING_IO_SIM_IDLE) {
+        sim->cpuOwner = index ;
+        sim->cpuSince = sim->now ;
+    }
+    else if (sim->cpuOwner != index) {
+        sim->ready [sim->readyCount++] = index ;
+        actor->wake = RING_IO_SIM_NEVER ;
+        return ;
+    }
+
+    switch (actor->state) {
+    case RING_IO_SIM_BEGIN:
+        if (actor->frame == channel->frames) {
+            actor->state = RING_IO_SIM_DONE ;
+            actor->wake  = RING_IO_SIM_NEVER ;
+            RING_IO_simRelease (sim, index, FALSE) ;
+            return ;
+        }
+        /* Wait for the start attribute of the frame */
+        taken = RING_IO_simTake (sim,
+                                 index,
+                                 2u * actor->channel,
+                                 &sim->config->dsp,
+                                 channel->readSize,
+                                 &cycles) ;
+        if ((taken == RING_IO_SIM_START) || (taken == RING_IO_SIM_PSTART)) {
+            actor->left  = channel->frameSize ;
+            actor->state = RING_IO_SIM_READ ;
+        }
+        break ;
+
+    case RING_IO_SIM_READ:
+        taken = RING_IO_simTake (sim,
+                                 index,
+                                 2u * actor->channel,
+                                 &sim->config->dsp,
+                                 channel->readSize,
+                                 &cycles) ;
+        taken = RING_IO_simEnd (actor, channel, taken) ;
+        if (taken == RING_IO_SIM_END) {
+            actor->state = RING_IO_SIM_STAGES ;
+        }
+        break ;
+
+    case RING_IO_SIM_STAGES:
+        taken  = RING_IO_SIM_DATA ;
+        cycles =   channel->stageFixed
+                 + (((Real64) channel->stagePerKB * channel->frameSize)
+                    / 1024.0) ;
+        actor->state = RING_IO_SIM_WBEGIN ;
+        break ;
+
+    default:
+        taken  = RING_IO_SIM_DATA ;
+        cycles = RING_IO_simPut (sim,
+                                 index,
+                                 (2u * actor->channel) + 1u,
+                                 &sim->config->dsp,
+                                 channel->writeSize) ;
+        if (cycles < 0.0) {
+            taken = RING_IO_SIM_NONE ;
+        }
+        else if (actor->state == RING_IO_SIM_WBEGIN) {
+            /* The end attribute is out */
+            actor->yield = TRUE ;
+            actor->state = RING_IO_SIM_BEGIN ;
+        }
+        break ;
+    }
+
+    if (taken != RING_IO_SIM_NONE) {
+        actor->wake = sim->now + cycles ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simReader
+ *
+ *  @desc   Steps the GPP reader of a channel.
+ *
+ *  @modif  sim
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simReader (RING_IO_Sim * sim, Uint32 index)
+{
+    RING_IO_SimActor *         actor   = &sim->actor [index] ;
+    const RING_IO_SimChannel * channel ;
+    Real64                     cycles  = 0.0 ;
+    Uint32                     taken ;
+
+    channel = &sim->config->channel [actor->channel] ;
+    RING_IO_simComplete (sim, index) ;
+
+    if (actor->frame == channel->frames) {
+        actor->state = RING_IO_SIM_DONE ;
+        actor->wake  = RING_IO_SIM_NEVER ;
+    }
+    else {
+        taken = RING_IO_simTake (sim,
+                                 index,
+                                 (2u * actor->channel) + 1u,
+                                 &sim->config->gpp,
+                                 channel->gppChunk,
+                                 &cycles) ;
+        if (taken != RING_IO_SIM_NONE) {
+            actor->wake = sim->now + cycles ;
+        }
+        if (taken == RING_IO_SIM_PSTART) {
+            actor->left = channel->frameSize ;
+        }
+        taken = RING_IO_simEnd (actor, channel, taken) ;
+        if (taken == RING_IO_SIM_END) {
+            sim->latency [actor->channel][actor->frame] =
+                      actor->wake
+                    - sim->arrival [actor->channel][actor->frame] ;
+            sim->result->channel [actor->channel].frames++ ;
+            actor->frame++ ;
+        }
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simComplete
+ *
+ *  @desc   Applies the effect of the completed call of an actor.
+ *
+ *  @modif  sim->ring, sim->actor
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simComplete (RING_IO_Sim * sim, Uint32 index)
+{
+    RING_IO_SimActor *     actor = &sim->actor [index] ;
+    RING_IO_SimRing *      ring  = &sim->ring [actor->pendRing] ;
+    RING_IO_SimRingStats * stats = &sim->result->ring [actor->pendRing] ;
+    Uint32                 tail ;
+
+    if (ring->writer == index) {
+        if (actor->pendAttr != RING_IO_SIM_NONE) {
+            tail = (ring->attrHead + ring->attrCount) % RING_IO_SIM_ATTRS ;
+            ring->attrPos [tail]  = ring->writePos ;
+            ring->attrKind [tail] = (Uint8) actor->pendAttr ;
+            ring->attrCount++ ;
+            if (ring->attrCount > stats->peakAttrs) {
+                stats->peakAttrs = ring->attrCount ;
+            }
+        }
+        if (actor->pendBytes != 0u) {
+            ring->writePos += actor->pendBytes ;
+            RING_IO_simFill (sim,
+                             actor->pendRing,
+                             ring->fill + actor->pendBytes) ;
+        }
+        if ((actor->pendAttr != RING_IO_SIM_NONE) || (actor->pendBytes != 0u)) {
+            RING_IO_simWake (sim, ring->reader) ;
+        }
+    }
+    else if (actor->pendBytes != 0u) {
+        RING_IO_simFill (sim, actor->pendRing, ring->fill - actor->pendBytes) ;
+        RING_IO_simWake (sim, ring->writer) ;
+    }
+
+    actor->pendAttr  = RING_IO_SIM_NONE ;
+    actor->pendBytes = 0u ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simPut
+ *
+ *  @desc   Starts the next writer call of a frame.
+ *
+ *  @modif  sim->actor [index]
+ *  ----------------------------------------------------------------------------
+ */
+static
+Real64
+RING_IO_simPut (RING_IO_Sim *            sim,
+                Uint32                   index,
+                Uint32                   ring,
+                const RING_IO_SimCosts * costs,
+                Uint32                   chunk)
+{
+    RING_IO_SimActor *         actor   = &sim->actor [index] ;
+    RING_IO_SimRing *          ringObj = &sim->ring [ring] ;
+    const RING_IO_SimChannel * channel ;
+    Real64                     cycles  = 0.0 ;
+    Uint32                     size ;
+
+    channel = &sim->config->channel [actor->channel] ;
+
+    /* A full attribute buffer stops the writer as a full data buffer does */
+    size = ringObj->size - ringObj->fill ;
+    if (   (ringObj->attrCount == RING_IO_SIM_ATTRS)
+        || ((actor->state == RING_IO_SIM_WRITE) && (size == 0u))) {
+        sim->result->ring [ring].fullWaits++ ;
+        RING_IO_simWait (sim, index) ;
+        cycles = RING_IO_SIM_NEVER ;
+    }
+    else if (actor->state == RING_IO_SIM_WBEGIN) {
+        actor->pendRing = ring ;
+        actor->left     = channel->frameSize ;
+        actor->state    = RING_IO_SIM_WRITE ;
+        if (channel->packAttrs == TRUE) {
+            /* Set and notified with the first size */
+            actor->packStart = TRUE ;
+        }
+        else {
+            actor->pendAttr = RING_IO_SIM_START ;
+            cycles          = costs->setAttribute + costs->sendNotify ;
+        }
+    }
+    else if (actor->state == RING_IO_SIM_WEND) {
+        actor->pendRing = ring ;
+        actor->pendAttr = RING_IO_SIM_END ;
+        cycles          = costs->setAttribute + costs->sendNotify ;
+        actor->frame++ ;
+        actor->state    = RING_IO_SIM_WBEGIN ;
+    }
+    else {
+        /* A flexible acquire takes what room there is */
+        size = (size < chunk) ? size : chunk ;
+        size = (size < actor->left) ? size : actor->left ;
+        actor->pendRing  = ring ;
+        actor->pendAttr  = (actor->packStart == TRUE) ? RING_IO_SIM_PSTART
+                                                      : RING_IO_SIM_SIZE ;
+        actor->pendBytes = size ;
+        cycles           =   costs->setvAttribute
+                           + costs->acquire
+                           + RING_IO_simCopy (costs, size)
+                           + costs->release ;
+        if (actor->packStart == TRUE) {
+            cycles          += costs->sendNotify ;
+            actor->packStart = FALSE ;
+        }
+        actor->left -= size ;
+        if ((actor->left == 0u) && (channel->packAttrs == TRUE)) {
+            /* The end goes with the record of the last span */
+            cycles += costs->sendNotify ;
+            actor->frame++ ;
+            actor->state = RING_IO_SIM_WBEGIN ;
+        }
+        else if (actor->left == 0u) {
+            actor->state = RING_IO_SIM_WEND ;
+        }
+    }
+
+    return cycles ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simEnd
+ *
+ *  @desc   Finds the end of a packed frame: a reader that takes the last
+ *          span of the frame has taken its end too.
+ *
+ *  @modif  actor->left
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+RING_IO_simEnd (RING_IO_SimActor *         actor,
+                const RING_IO_SimChannel * channel,
+                Uint32                     taken)
+{
+    if ((taken == RING_IO_SIM_DATA) && (channel->packAttrs == TRUE)) {
+        actor->left -= (actor->pendBytes < actor->left) ? actor->pendBytes
+                                                        : actor->left ;
+        if (actor->left == 0u) {
+            taken = RING_IO_SIM_END ;
+        }
+    }
+
+    return taken ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simTake
+ *
+ *  @desc   Starts the next reader call.
+ *
+ *  @modif  sim->ring [ring], sim->actor [index]
+ *  ----------------------------------------------------------------------------
+ */
+static
+Uint32
+RING_IO_simTake (RING_IO_Sim *            sim,
+                 Uint32                   index,
+                 Uint32                   ring,
+                 const RING_IO_SimCosts * costs,
+                 Uint32                   chunk,
+                 Real64 *                 cycles)
+{
+    RING_IO_SimActor * actor   = &sim->actor [index] ;
+    RING_IO_SimRing *  ringObj = &sim->ring [ring] ;
+    Uint32             taken   = RING_IO_SIM_NONE ;
+    Uint32             size ;
+
+    *cycles = 0.0 ;
+
+    if (   (ringObj->attrCount != 0u)
+        && (ringObj->attrPos [ringObj->attrHead] == ringObj->readPos)) {
+        /* getAttribute, followed by getvAttribute for a variable one */
+        taken   = ringObj->attrKind [ringObj->attrHead] ;
+        *cycles = costs->getAttribute ;
+        if ((taken == RING_IO_SIM_PSTART) || (taken == RING_IO_SIM_SIZE)) {
+            *cycles += costs->getvAttribute ;
+        }
+        ringObj->attrHead = (ringObj->attrHead + 1u) % RING_IO_SIM_ATTRS ;
+        ringObj->attrCount-- ;
+    }
+    else {
+        /* An acquire stops at the next attribute */
+        size = ringObj->writePos - ringObj->readPos ;
+        if (ringObj->attrCount != 0u) {
+            size = ringObj->attrPos [ringObj->attrHead] - ringObj->readPos ;
+        }
+        size = (size < chunk) ? size : chunk ;
+
+        if (size == 0u) {
+            sim->result->ring [ring].emptyWaits++ ;
+            RING_IO_simWait (sim, index) ;
+        }
+        else {
+            taken              = RING_IO_SIM_DATA ;
+            ringObj->readPos  += size ;
+            actor->pendRing    = ring ;
+            actor->pendBytes   = size ;
+            *cycles            =   costs->acquire
+                                 + RING_IO_simCopy (costs, size)
+                                 + costs->release ;
+        }
+    }
+
+    return taken ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simFill
+ *
+ *  @desc   Changes the fill of a RingIO.
+ *
+ *  @modif  sim->ring [ring], sim->result->ring [ring]
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simFill (RING_IO_Sim * sim, Uint32 ring, Uint32 fill)
+{
+    RING_IO_SimRing * ringObj = &sim->ring [ring] ;
+
+    ringObj->fillArea  += ringObj->fill * (sim->now - ringObj->fillSince) ;
+    ringObj->fillSince  = sim->now ;
+    ringObj->fill       = fill ;
+    if (fill > sim->result->ring [ring].peakFill) {
+        sim->result->ring [ring].peakFill = fill ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simWake
+ *
+ *  @desc   Wakes an actor waiting on a RingIO.
+ *
+ *  @modif  sim->actor [index]
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simWake (RING_IO_Sim * sim, Uint32 index)
+{
+    RING_IO_SimActor * actor = &sim->actor [index] ;
+
+    if (actor->waiting == TRUE) {
+        actor->waiting = FALSE ;
+        actor->wake    = sim->now + sim->config->notifyLatency ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simWait
+ *
+ *  @desc   Makes an actor wait on a RingIO.
+ *
+ *  @modif  sim->actor [index]
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simWait (RING_IO_Sim * sim, Uint32 index)
+{
+    RING_IO_SimActor * actor = &sim->actor [index] ;
+
+    actor->waiting = TRUE ;
+    actor->wake    = RING_IO_SIM_NEVER ;
+    if (sim->cpuOwner == index) {
+        RING_IO_simRelease (sim, index, FALSE) ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simRelease
+ *
+ *  @desc   Gives up the DSP CPU held by a task.
+ *
+ *  @modif  sim->cpuOwner, sim->ready
+ *  ----------------------------------------------------------------------------
+ */
+static
+Void
+RING_IO_simRelease (RING_IO_Sim * sim, Uint32 index, Bool yield)
+{
+    Uint32 next ;
+    Uint32 i ;
+
+    sim->cpuBusy  += sim->now - sim->cpuSince ;
+    sim->cpuOwner  = RING_IO_SIM_IDLE ;
+
+    if (yield == TRUE) {
+        sim->ready [sim->readyCount++] = index ;
+        sim->actor [index].wake        = RING_IO_SIM_NEVER ;
+    }
+
+    if (sim->readyCount != 0u) {
+        next = sim->ready [0] ;
+        sim->readyCount-- ;
+        for (i = 0u ; i < sim->readyCount ; i++) {
+            sim->ready [i] = sim->ready [i + 1u] ;
+        }
+        sim->actor [next].wake = sim->now ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simCopy
+ *
+ *  @desc   Cycles of a copy.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+Real64
+RING_IO_simCopy (const RING_IO_SimCosts * costs, Uint32 size)
+{
+    return ((Real64) costs->copyPerKB * size) / 1024.0 ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_simCompare
+ *
+ *  @desc   qsort comparison of two latencies.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static
+int
+RING_IO_simCompare (const void * a, const void * b)
+{
+    Real64 x = *(const Real64 *) a ;
+    Real64 y = *(const Real64 *) b ;
+
+    return (x < y) ? -1 : ((x > y) ? 1 : 0) ;
+}
+
+
+#if defined (RING_IO_SIM_MAIN)
+/** ============================================================================
+ *  @const  RING_IO_SIM_PARAMS, RING_IO_SIM_PARAM_LEN
+ *
+ *  @desc   Number of command line parameters and longest parameter name.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_PARAMS      ((11u * RING_IO_SIM_CHANNELS) + 16u + 2u)
+#define RING_IO_SIM_PARAM_LEN   24u
+
+/** ============================================================================
+ *  @func   main
+ *
+ *  @desc   Runs the default configuration with the name=value overrides
+ *          given on the command line and prints the prediction, e.g.
+ *          ring_io_sim outring1=4096 write1=512 pack1=1 dsp.notify=1800
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+int
+main (int argc, char ** argv)
+{
+    static const Char8 * channelNames [11u] = {
+        "frames", "framesize", "period", "inring", "outring", "chunk",
+        "read", "write", "stagefixed", "stageperkb", "pack"
+    } ;
+    static const Char8 * costNames [8u] = {
+        "acquire", "release", "setattr", "setvattr", "getattr", "getvattr",
+        "notify", "copy"
+    } ;
+    RING_IO_SimConfig   config ;
+    RING_IO_SimResult   result ;
+    RING_IO_SimChannel * channel ;
+    RING_IO_SimCosts *  costs ;
+    Char8               names [RING_IO_SIM_PARAMS][RING_IO_SIM_PARAM_LEN] ;
+    Uint32 *            values [RING_IO_SIM_PARAMS] ;
+    Uint32              pack [RING_IO_SIM_CHANNELS] ;
+    Uint32              count = 0u ;
+    Int32               status = RINGIO_SUCCESS ;
+    Char8 *             value ;
+    Uint32              i ;
+    Uint32              j ;
+    int                 arg ;
+
+    RING_IO_simDefaults (&config) ;
+
+    for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+        channel = &config.channel [i] ;
+        pack [i] = channel->packAttrs ;
+        values [count + 0u]  = &channel->frames ;
+        values [count + 1u]  = &channel->frameSize ;
+        values [count + 2u]  = &channel->framePeriod ;
+        values [count + 3u]  = &channel->inRingSize ;
+        values [count + 4u]  = &channel->outRingSize ;
+        values [count + 5u]  = &channel->gppChunk ;
+        values [count + 6u]  = &channel->readSize ;
+        values [count + 7u]  = &channel->writeSize ;
+        values [count + 8u]  = &channel->stageFixed ;
+        values [count + 9u]  = &channel->stagePerKB ;
+        values [count + 10u] = &pack [i] ;
+        for (j = 0u ; j < 11u ; j++) {
+            snprintf (names [count++], RING_IO_SIM_PARAM_LEN, "%s%u",
+                      channelNames [j], i + 1u) ;
+        }
+    }
+
+    for (i = 0u ; i < 2u ; i++) {
+        costs = (i == 0u) ? &config.dsp : &config.gpp ;
+        values [count + 0u] = &costs->acquire ;
+        values [count + 1u] = &costs->release ;
+        values [count + 2u] = &costs->setAttribute ;
+        values [count + 3u] = &costs->setvAttribute ;
+        values [count + 4u] = &costs->getAttribute ;
+        values [count + 5u] = &costs->getvAttribute ;
+        values [count + 6u] = &costs->sendNotify ;
+        values [count + 7u] = &costs->copyPerKB ;
+        for (j = 0u ; j < 8u ; j++) {
+            snprintf (names [count++], RING_IO_SIM_PARAM_LEN, "%s.%s",
+                      (i == 0u) ? "dsp" : "gpp", costNames [j]) ;
+        }
+    }
+
+    values [count] = &config.notifyLatency ;
+    strcpy (names [count++], "latency") ;
+    values [count] = &config.cpuMHz ;
+    strcpy (names [count++], "mhz") ;
+
+    for (arg = 1 ; (arg < argc) && (status == RINGIO_SUCCESS) ; arg++) {
+        value = strchr (argv [arg], '=') ;
+        status = RINGIO_EFAILURE ;
+        for (i = 0u ; (i < count) && (value != NULL) ; i++) {
+            if (   (strncmp (argv [arg], names [i], value - argv [arg]) == 0)
+                && (strlen (names [i]) == (size_t) (value - argv [arg]))) {
+                *values [i] = (Uint32) strtoul (value + 1, NULL, 0) ;
+                status      = RINGIO_SUCCESS ;
+            }
+        }
+        if (status != RINGIO_SUCCESS) {
+            printf ("usage: %s [name=value ...], names:\n", argv [0]) ;
+            for (i = 0u ; i < count ; i++) {
+                printf ("  %s = %u\n", names [i], *values [i]) ;
+            }
+        }
+    }
+
+    if (status == RINGIO_SUCCESS) {
+        for (i = 0u ; i < RING_IO_SIM_CHANNELS ; i++) {
+            config.channel [i].packAttrs = (pack [i] != 0u) ? TRUE : FALSE ;
+        }
+        status = RING_IO_simRun (&config, &result) ;
+        if (status != RINGIO_SUCCESS) {
+            printf ("configuration stalls or is invalid\n") ;
+        }
+        RING_IO_simReport (&config, &result) ;
+    }
+
+    return (status == RINGIO_SUCCESS) ? 0 : 1 ;
+}
+#endif /* if defined (RING_IO_SIM_MAIN) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,360 @@
+/** ============================================================================
+ *  @file   ring_io_sim.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/gpp/
+ *
+ *  @desc   Discrete-event capacity model of the RING_IO sample: the two
+ *          channels, each with the GPP writer, the DSP task and the GPP
+ *          reader, the four RingIOs between them and the DSP CPU the two
+ *          tasks share. It runs in virtual time, in DSP cycles, with the
+ *          costs measured by the DSP benchmarks (ring_io_bench.h), to size
+ *          the RingIOs and acquire sizes of a configuration before trying
+ *          it on a target.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_SIM_)
+#define RING_IO_SIM_
+
+/*  --------------------------- RingIO Headers ----------------------------- */
+#if defined (RING_IO_LOCAL)
+#include <ring_io_local.h>
+#else /* if defined (RING_IO_LOCAL) */
+#include <dsplink.h>
+#include <ringio.h>
+#endif /* if defined (RING_IO_LOCAL) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_SIM_CHANNELS, RING_IO_SIM_RINGS
+ *
+ *  @desc   Number of channels modelled, and of RingIOs: the input and the
+ *          output RingIO of each channel. Ring 2c is the input of channel c,
+ *          ring 2c+1 its output.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_CHANNELS    2u
+#define RING_IO_SIM_RINGS       (2u * RING_IO_SIM_CHANNELS)
+
+/** ============================================================================
+ *  @const  RING_IO_SIM_ATTRS
+ *
+ *  @desc   Largest number of attributes a modelled RingIO holds at a time.
+ *          A writer finding it full waits as for a full data buffer.
+ *  ============================================================================
+ */
+#define RING_IO_SIM_ATTRS       256u
+
+/** ============================================================================
+ *  @name   RING_IO_SimCosts
+ *
+ *  @desc   Cost in DSP cycles of the RingIO calls and the copies of one
+ *          side. The DSP figures come from RING_IO_benchRingIo and
+ *          RING_IO_benchCopy, the GPP ones from timing the client
+ *          converted to DSP cycles.
+ *
+ *  @field  acquire
+ *              RingIO_acquire.
+ *  @field  release
+ *              RingIO_release.
+ *  @field  setAttribute
+ *              RingIO_setAttribute.
+ *  @field  setvAttribute
+ *              RingIO_setvAttribute.
+ *  @field  getAttribute
+ *              RingIO_getAttribute.
+ *  @field  getvAttribute
+ *              RingIO_getvAttribute, taken after a getAttribute for every
+ *              variable attribute.
+ *  @field  sendNotify
+ *              RingIO_sendNotify.
+ *  @field  copyPerKB
+ *              Copy between a buffer and a RingIO span, per 1024 bytes
+ *              ("BENCH copy" on the DSP).
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimCosts_tag {
+    Uint32    acquire ;
+    Uint32    release ;
+    Uint32    setAttribute ;
+    Uint32    setvAttribute ;
+    Uint32    getAttribute ;
+    Uint32    getvAttribute ;
+    Uint32    sendNotify ;
+    Uint32    copyPerKB ;
+} RING_IO_SimCosts ;
+
+/** ============================================================================
+ *  @name   RING_IO_SimChannel
+ *
+ *  @desc   Proposed configuration of a channel.
+ *
+ *  @field  frames
+ *              Frames to run through the channel.
+ *  @field  frameSize
+ *              Frame size in bytes (RING_IO_dataBufSize3/4).
+ *  @field  framePeriod
+ *              DSP cycles between the arrivals of two frames at the GPP
+ *              writer, 0 to send them back to back.
+ *  @field  inRingSize
+ *              Data buffer size of the input RingIO, created by the GPP.
+ *  @field  outRingSize
+ *              Data buffer size of the output RingIO
+ *              (RING_IO_dataBufSize1/2).
+ *  @field  gppChunk
+ *              Chunk size of the GPP client, for both of its RingIOs.
+ *  @field  readSize
+ *              Largest DSP reader acquire.
+ *  @field  writeSize
+ *              Largest DSP writer acquire (RINGIO_WRITE_ACQ_SIZE).
+ *  @field  stageFixed
+ *              Cycles of the processing stages per frame.
+ *  @field  stagePerKB
+ *              Cycles of the processing stages per 1024 bytes of frame
+ *              ("BENCH scale" figures).
+ *  @field  packAttrs
+ *              If TRUE, both writers pack the start and the first size of
+ *              a frame into one attribute, and its end into the record of
+ *              its last span (RING_IO_PACK_ATTRS).
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimChannel_tag {
+    Uint32    frames ;
+    Uint32    frameSize ;
+    Uint32    framePeriod ;
+    Uint32    inRingSize ;
+    Uint32    outRingSize ;
+    Uint32    gppChunk ;
+    Uint32    readSize ;
+    Uint32    writeSize ;
+    Uint32    stageFixed ;
+    Uint32    stagePerKB ;
+    Bool      packAttrs ;
+} RING_IO_SimChannel ;
+
+/** ============================================================================
+ *  @name   RING_IO_SimConfig
+ *
+ *  @desc   Configuration and calibration of a run.
+ *
+ *  @field  channel
+ *              Channel configurations. A channel with no frames is idle.
+ *  @field  dsp
+ *              Costs of the DSP side.
+ *  @field  gpp
+ *              Costs of the GPP side.
+ *  @field  notifyLatency
+ *              DSP cycles from a notification, or a release seen by the
+ *              notifier of the other side, to the waiting side running.
+ *              Half the "BENCH  notify local callback" figure with the
+ *              link latency added, or half the ping-pong round trip of
+ *              ring_io_bench_host.
+ *  @field  cpuMHz
+ *              DSP clock, to convert cycles to time.
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimConfig_tag {
+    RING_IO_SimChannel  channel [RING_IO_SIM_CHANNELS] ;
+    RING_IO_SimCosts    dsp ;
+    RING_IO_SimCosts    gpp ;
+    Uint32              notifyLatency ;
+    Uint32              cpuMHz ;
+} RING_IO_SimConfig ;
+
+/** ============================================================================
+ *  @name   RING_IO_SimRingStats
+ *
+ *  @desc   Predicted use of a RingIO.
+ *
+ *  @field  peakFill
+ *              Largest number of bytes held.
+ *  @field  meanFill
+ *              Time-weighted mean of the bytes held.
+ *  @field  peakAttrs
+ *              Largest number of attributes held, to size the attribute
+ *              buffer (RING_IO_attrBufSize).
+ *  @field  fullWaits
+ *              Times the writer waited for room.
+ *  @field  emptyWaits
+ *              Times the reader waited for data.
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimRingStats_tag {
+    Uint32    peakFill ;
+    Real64    meanFill ;
+    Uint32    peakAttrs ;
+    Uint32    fullWaits ;
+    Uint32    emptyWaits ;
+} RING_IO_SimRingStats ;
+
+/** ============================================================================
+ *  @name   RING_IO_SimChannelStats
+ *
+ *  @desc   Predicted performance of a channel. The latency of a frame runs
+ *          from its arrival at the GPP writer to its end attribute being
+ *          taken by the GPP reader.
+ *
+ *  @field  frames
+ *              Frames delivered.
+ *  @field  framesPerSec
+ *              Frames delivered per second.
+ *  @field  MBps
+ *              Frame data delivered, in megabytes per second.
+ *  @field  latencyMean, latencyP50, latencyP90, latencyP99, latencyMax
+ *              Mean, percentiles and largest frame latency, in
+ *              microseconds.
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimChannelStats_tag {
+    Uint32    frames ;
+    Real64    framesPerSec ;
+    Real64    MBps ;
+    Real64    latencyMean ;
+    Real64    latencyP50 ;
+    Real64    latencyP90 ;
+    Real64    latencyP99 ;
+    Real64    latencyMax ;
+} RING_IO_SimChannelStats ;
+
+/** ============================================================================
+ *  @name   RING_IO_SimResult
+ *
+ *  @desc   Prediction of a run.
+ *
+ *  @field  cycles
+ *              Virtual time of the run, in DSP cycles.
+ *  @field  dspLoad
+ *              Fraction of the run the DSP CPU was busy.
+ *  @field  channel
+ *              Per channel predictions.
+ *  @field  ring
+ *              Per RingIO predictions, indexed as RING_IO_SIM_RINGS.
+ *  ============================================================================
+ */
+typedef struct RING_IO_SimResult_tag {
+    Real64                   cycles ;
+    Real64                   dspLoad ;
+    RING_IO_SimChannelStats  channel [RING_IO_SIM_CHANNELS] ;
+    RING_IO_SimRingStats     ring [RING_IO_SIM_RINGS] ;
+} RING_IO_SimResult ;
+
+
+/** ============================================================================
+ *  @func   RING_IO_simDefaults
+ *
+ *  @desc   Fills a configuration with the sample defaults: frames of 1024
+ *          and 2048 bytes, 10240 byte RingIOs and 1024 byte acquires. The
+ *          costs are rough placeholders, to be replaced with the figures
+ *          measured on the target.
+ *
+ *  @arg    config
+ *              Configuration to fill.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simRun
+ *  ============================================================================
+ */
+Void
+RING_IO_simDefaults (RING_IO_SimConfig * config) ;
+
+/** ============================================================================
+ *  @func   RING_IO_simRun
+ *
+ *  @desc   Runs a configuration in virtual time until every frame has been
+ *          delivered.
+ *
+ *  @arg    config
+ *              Configuration to run.
+ *  @arg    result
+ *              Location to receive the prediction.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Every frame has been delivered.
+ *          RINGIO_EFAILURE
+ *              Invalid configuration, out of memory, or the channels
+ *              stalled with frames left; result then covers the frames
+ *              delivered.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simReport
+ *  ============================================================================
+ */
+Int32
+RING_IO_simRun (const RING_IO_SimConfig * config, RING_IO_SimResult * result) ;
+
+/** ============================================================================
+ *  @func   RING_IO_simReport
+ *
+ *  @desc   Prints a prediction to the standard output.
+ *
+ *  @arg    config
+ *              Configuration that was run.
+ *  @arg    result
+ *              Its prediction.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_simRun
+ *  ============================================================================
+ */
+Void
+RING_IO_simReport (const RING_IO_SimConfig * config,
+                   const RING_IO_SimResult * result) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (RING_IO_SIM_) */
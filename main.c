@@ -47,6 +47,7 @@
 #include <sio.h>
 #include <tsk.h>
 #include <pool.h>
+#include <gbl.h>
 
 /*  --------------------------- DSP/BIOS LINK Headers ----------------------- */
 #include <dsplink.h>
@@ -63,6 +64,11 @@
 /*  --------------------------- Sample Headers ---------------------------- */
 #include <tskRingIo.h>
 #include <ring_io_config.h>
+#include <ring_io_copy.h>
+#include <ring_io_place.h>
+#if defined (RING_IO_BENCH)
+#include <ring_io_bench.h>
+#endif /* if defined (RING_IO_BENCH) */
 
 /** ============================================================================
  *  @const  FILEID
@@ -352,6 +358,9 @@ static void HAL_initIsr (Ptr arg);
  */
 static Int tskRingIo1();
 static Int tskRingIo2();
+#if defined (RING_IO_BENCH)
+static Int tskRingIoBench();
+#endif /* if defined (RING_IO_BENCH) */
 TSKRING_IO_TransferInfo * info1;
 TSKRING_IO_TransferInfo * info2;
 /** ============================================================================
@@ -366,6 +375,8 @@ Void main(Int argc, Char *argv[]) {
 	/* TSK based ring_io application */
 	TSK_Handle tskRingIoTask1; //for sending
 	TSK_Handle tskRingIoTask2; // for receiving
+	Bool serve1;
+	Bool serve2;
 
 	TSK_Attrs attrs = TSK_ATTRS;
 
@@ -393,37 +404,64 @@ Void main(Int argc, Char *argv[]) {
 	/* Get the size of the data buffer to be allocated for the RingIO. */
 	RING_IO_dataBufSize1 = 10240;
 	RING_IO_dataBufSize2 = 10240;
-	/* Get the size of the attribute  buffer to be allocated for the RingIO.*/
-	RING_IO_attrBufSize = 2048;
+	/* Get the size of the attribute  buffer to be allocated for the RingIO.
+	 * Packed records from both channels need fewer entries.
+	 */
+	if ((RING_IO_PACK_ATTRS1 == TRUE) && (RING_IO_PACK_ATTRS2 == TRUE)) {
+		RING_IO_attrBufSize = RING_IO_PACK_ATTRBUF_SIZE;
+	} else {
+		RING_IO_attrBufSize = 2048;
+	}
 
 	/* Get the size of the footbuffer to be allocated for the RingIO. */
 	RING_IO_footBufSize = 0;
 #endif
 
-	/* Create Phase */
-	TSKRING_IO_create1(&info1);
-	/* Create Phase */
-	TSKRING_IO_create2(&info2);
+	/* Set up the input copy engines used by both channels */
+	RING_IO_copyInit();
+
+	/* Create Phase, for the channels placed on this DSP */
+	serve1 = RING_IO_placeServes(RING_IO_PLACE1, GBL_getProcId());
+	serve2 = RING_IO_placeServes(RING_IO_PLACE2, GBL_getProcId());
+	if (serve1) {
+		TSKRING_IO_create1(&info1);
+	}
+	if (serve2) {
+		TSKRING_IO_create2(&info2);
+	}
 
 
 	attrs.stacksize = 16384;
 
+#if defined (RING_IO_BENCH)
+	/* Benchmark task runs first, at a higher priority than the RING_IO tasks */
+	attrs.priority = TSK_ATTRS.priority + 1;
+	if (TSK_create(tskRingIoBench, &attrs, 0) == NULL) {
+		LOG_printf(&trace, "Create RING_IO BENCH TSK: Failed.\n");
+	}
+	attrs.priority = TSK_ATTRS.priority;
+#endif /* if defined (RING_IO_BENCH) */
+
 	/* Creating task for RING_IO application */
 	//tskRingIoTask1 = TSK_create(tskRingIo1, NULL, 0);
-	tskRingIoTask1 = TSK_create(tskRingIo1, &attrs, 0);
-	if (tskRingIoTask1 != NULL) {
-		LOG_printf(&trace, "Create RING_IO TSK1: Success\n");
-	} else {
-		LOG_printf(&trace, "Create RING_IO TSK1: Failed.\n");
+	if (serve1) {
+		tskRingIoTask1 = TSK_create(tskRingIo1, &attrs, 0);
+		if (tskRingIoTask1 != NULL) {
+			LOG_printf(&trace, "Create RING_IO TSK1: Success\n");
+		} else {
+			LOG_printf(&trace, "Create RING_IO TSK1: Failed.\n");
+		}
 	}
 
 	/* Creating task for RING_IO application */
 	//tskRingIoTask2 = TSK_create(tskRingIo2, NULL, 0);
-	tskRingIoTask2 = TSK_create(tskRingIo2, &attrs, 0);
-	if (tskRingIoTask2 != NULL) {
-		LOG_printf(&trace, "Create RING_IO TSK2: Success\n");
-	} else {
-		LOG_printf(&trace, "Create RING_IO TSK2: Failed.\n");
+	if (serve2) {
+		tskRingIoTask2 = TSK_create(tskRingIo2, &attrs, 0);
+		if (tskRingIoTask2 != NULL) {
+			LOG_printf(&trace, "Create RING_IO TSK2: Success\n");
+		} else {
+			LOG_printf(&trace, "Create RING_IO TSK2: Failed.\n");
+		}
 	}
 
 }
@@ -481,6 +519,42 @@ static Int tskRingIo2() {
 	return (status);
 }
 
+#if defined (RING_IO_BENCH)
+/** ----------------------------------------------------------------------------
+ *  @func   tskRingIoBench
+ *
+ *  @desc   Task running the on-target microbenchmarks.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Int tskRingIoBench() {
+	Int status = SYS_OK;
+
+	status = RING_IO_benchKernels();
+	if (status != SYS_OK) {
+		SET_FAILURE_REASON(status);
+	}
+
+	status = RING_IO_benchCopy();
+	if (status != SYS_OK) {
+		SET_FAILURE_REASON(status);
+	}
+
+	status = RING_IO_benchPrefetch();
+	if (status != SYS_OK) {
+		SET_FAILURE_REASON(status);
+	}
+
+	status = RING_IO_benchRingIo();
+	if (status != SYS_OK) {
+		SET_FAILURE_REASON(status);
+	}
+
+	return (status);
+}
+#endif /* if defined (RING_IO_BENCH) */
+
 #if defined (DSP_BOOTMODE_NOBOOT)
 /** ----------------------------------------------------------------------------
  *  @func   HAL_initIsr
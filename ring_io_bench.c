@@ -0,0 +1,770 @@
+/** ============================================================================
+ *  @file   ring_io_bench.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   On-target microbenchmarks of the RING_IO sample.
+ *          Cycle counts are derived from CLK_gethtime() and reported per frame
+ *          on the trace LOG.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+/* ---------------------------- DSP/BIOS Headers ---------------------------- */
+#include <std.h>
+#include <log.h>
+#include <clk.h>
+#include <mem.h>
+#include <sem.h>
+#include <gbl.h>
+#include <bcache.h>
+
+/*  --------------------------- DSP/BIOS LINK Headers ----------------------- */
+#include <dsplink.h>
+#include <failure.h>
+
+/*  --------------------------- RingIO Headers ----------------------------- */
+#include <ringio.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_config.h>
+#include <ring_io_kernels.h>
+#include <ring_io_copy.h>
+#include <ring_io_bench.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+#if defined (RING_IO_BENCH)
+
+/** ============================================================================
+ *  @const  FILEID
+ *
+ *  @desc   FILEID is used by SET_FAILURE_REASON macro.
+ *  ============================================================================
+ */
+#define FILEID  FID_APP_C
+
+/** ============================================================================
+ *  @name   trace
+ *
+ *  @desc   trace LOG_Obj used to do LOG_printf
+ *  ============================================================================
+ */
+extern LOG_Obj trace;
+
+/** ============================================================================
+ *  @name   RING_IO_AttrBufSize
+ *
+ *  @desc   Size of the attribute buffer to be allocated for the RingIO.
+ *  ============================================================================
+ */
+extern Uint16 RING_IO_attrBufSize;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_benchCycles
+ *
+ *  @desc   Converts the CLK_gethtime() counts spent on RING_IO_BENCH_ITERATIONS
+ *          frames to CPU cycles per frame.
+ *
+ *  @arg    elapsed
+ *              CLK_gethtime() counts for all iterations.
+ *
+ *  @ret    <cycles>
+ *              CPU cycles per frame.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 RING_IO_benchCycles(Uint32 elapsed);
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_benchRingIoRun
+ *
+ *  @desc   Measures the RingIO operations for one cache flag combination and
+ *          acquire size.
+ *
+ *  @arg    flags
+ *              RingIO open flags.
+ *  @arg    size
+ *              Acquire size in bytes.
+ *  @arg    clockCost
+ *              CLK_gethtime() counts spent reading the clock, per call.
+ *  @arg    cost
+ *              Location to receive the costs.
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  The benchmark RingIO exists.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_benchRingIo
+ *  ----------------------------------------------------------------------------
+ */
+static Int RING_IO_benchRingIoRun(Uint32 flags, Uint32 size, Uint32 clockCost,
+		RING_IO_BenchRingIoCost * cost);
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_benchNotify
+ *
+ *  @desc   Notifier of the benchmark RingIO ends, posts the semaphore given
+ *          as parameter.
+ *
+ *  @arg    handle
+ *              Handle of the notified end.
+ *  @arg    param
+ *              Semaphore to post.
+ *  @arg    msg
+ *              Message, unused.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_benchRingIoRun
+ *  ----------------------------------------------------------------------------
+ */
+static Void RING_IO_benchNotify(RingIO_Handle handle, RingIO_NotifyParam param,
+		RingIO_NotifyMsg msg);
+
+/** ============================================================================
+ *  @const  RING_IO_BENCH_RINGIO_NAME
+ *
+ *  @desc   Name of the RingIO used by RING_IO_benchRingIo.
+ *  ============================================================================
+ */
+#define RING_IO_BENCH_RINGIO_NAME   "RINGIOBENCH"
+
+/** ============================================================================
+ *  @const  RING_IO_BENCH_ATTR
+ *
+ *  @desc   Fixed attribute type and notify message used by
+ *          RING_IO_benchRingIo. The RingIO carries no frames, so any value
+ *          will do.
+ *  ============================================================================
+ */
+#define RING_IO_BENCH_ATTR          1u
+
+/** ============================================================================
+ *  @name   RING_IO_benchRingIoCosts
+ *
+ *  @desc   Results of RING_IO_benchRingIo.
+ *  ============================================================================
+ */
+RING_IO_BenchRingIoCost RING_IO_benchRingIoCosts[RING_IO_BENCH_RINGIO_FLAGS]
+		[RING_IO_BENCH_RINGIO_SIZES];
+
+/** ============================================================================
+ *  @name   RING_IO_benchPing, RING_IO_benchPong
+ *
+ *  @desc   Semaphores posted by the notifiers of the reader and the writer
+ *          end of the benchmark RingIO.
+ *  ============================================================================
+ */
+static SEM_Obj RING_IO_benchPing;
+static SEM_Obj RING_IO_benchPong;
+
+/** ============================================================================
+ *  @func   RING_IO_benchKernels
+ *
+ *  @desc   Compares the cycles per frame of the generic scale kernel with the
+ *          compile-time specialised kernels.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int RING_IO_benchKernels(Void) {
+	Int status = SYS_OK;
+	Char * buffer;
+	Uint32 start;
+	Uint32 n;
+	Uint32 offset;
+
+	buffer = MEM_calloc(DSPLINK_SEGID, RING_IO_BENCH_FRAMESIZE,
+			DSPLINK_BUF_ALIGN);
+	if (buffer == NULL) {
+		status = SYS_EALLOC;
+		SET_FAILURE_REASON(status);
+	}
+
+	if (status == SYS_OK) {
+		/* Generic path: opcode and MAU size resolved per element */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			RING_IO_apply((RingIO_BufPtr *) buffer, OP_FACTOR, OP_MULTIPLY,
+					RING_IO_BENCH_FRAMESIZE);
+		}
+		LOG_printf(&trace, "BENCH scale generic: %d cycles/frame",
+				RING_IO_benchCycles(CLK_gethtime() - start));
+
+		/* Specialised kernel, frame size known only at run time */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			RING_IO_scaleMulFactor((RING_IO_Mau *) buffer,
+					RING_IO_MAUS(RING_IO_BENCH_FRAMESIZE));
+		}
+		LOG_printf(&trace, "BENCH scale specialised: %d cycles/frame",
+				RING_IO_benchCycles(CLK_gethtime() - start));
+
+		/* Specialised kernel over constant-size blocks, as in the
+		 * RING_IO_FIXED_CONFIG build
+		 */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			for (offset = 0; offset < RING_IO_BENCH_FRAMESIZE;
+					offset += RING_IO_STAGE_BLOCKSIZE) {
+				RING_IO_scaleMulFactor((RING_IO_Mau *) (buffer + offset),
+						RING_IO_MAUS(RING_IO_STAGE_BLOCKSIZE));
+			}
+		}
+		LOG_printf(&trace, "BENCH scale fixed blocks: %d cycles/frame",
+				RING_IO_benchCycles(CLK_gethtime() - start));
+
+		MEM_free(DSPLINK_SEGID, buffer, RING_IO_BENCH_FRAMESIZE);
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_benchCopy
+ *
+ *  @desc   Measures how much of the input copy the RING_IO_copy engine hides
+ *          behind the stages.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int RING_IO_benchCopy(Void) {
+	Int status = SYS_OK;
+	Char * src = NULL;
+	Char * dst = NULL;
+	Uint32 start;
+	Uint32 n;
+	Uint32 offset;
+	Uint32 copyCycles;
+	Uint32 computeCycles;
+	Uint32 pipeCycles;
+
+	src = MEM_calloc(DSPLINK_SEGID, RING_IO_BENCH_FRAMESIZE,
+			DSPLINK_BUF_ALIGN);
+	dst = MEM_calloc(DSPLINK_SEGID, RING_IO_BENCH_FRAMESIZE,
+			DSPLINK_BUF_ALIGN);
+	if ((src == NULL) || (dst == NULL)) {
+		status = SYS_EALLOC;
+		SET_FAILURE_REASON(status);
+	}
+
+	if (status == SYS_OK) {
+		/* Copy alone */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			for (offset = 0; offset < RING_IO_BENCH_FRAMESIZE;
+					offset += RING_IO_STAGE_BLOCKSIZE) {
+				RING_IO_copySubmit(0, dst + offset, src + offset,
+						RING_IO_STAGE_BLOCKSIZE);
+				RING_IO_copyWait(0);
+			}
+		}
+		copyCycles = RING_IO_benchCycles(CLK_gethtime() - start);
+
+		/* Compute alone */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			for (offset = 0; offset < RING_IO_BENCH_FRAMESIZE;
+					offset += RING_IO_STAGE_BLOCKSIZE) {
+				RING_IO_scaleMulFactor((RING_IO_Mau *) (dst + offset),
+						RING_IO_MAUS(RING_IO_STAGE_BLOCKSIZE));
+			}
+		}
+		computeCycles = RING_IO_benchCycles(CLK_gethtime() - start);
+
+		/* Pipelined: block N is computed while block N + 1 is copied */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			RING_IO_copySubmit(0, dst, src, RING_IO_STAGE_BLOCKSIZE);
+			RING_IO_copyWait(0);
+			for (offset = 0; offset < RING_IO_BENCH_FRAMESIZE;
+					offset += RING_IO_STAGE_BLOCKSIZE) {
+				if ((offset + RING_IO_STAGE_BLOCKSIZE)
+						< RING_IO_BENCH_FRAMESIZE) {
+					RING_IO_copySubmit(0,
+							dst + offset + RING_IO_STAGE_BLOCKSIZE,
+							src + offset + RING_IO_STAGE_BLOCKSIZE,
+							RING_IO_STAGE_BLOCKSIZE);
+				}
+				RING_IO_scaleMulFactor((RING_IO_Mau *) (dst + offset),
+						RING_IO_MAUS(RING_IO_STAGE_BLOCKSIZE));
+				RING_IO_copyWait(0);
+			}
+		}
+		pipeCycles = RING_IO_benchCycles(CLK_gethtime() - start);
+
+		LOG_printf(&trace, "BENCH copy: %d cycles/frame", copyCycles);
+		LOG_printf(&trace, "BENCH copy compute: %d cycles/frame",
+				computeCycles);
+		LOG_printf(&trace, "BENCH copy pipelined: %d cycles/frame",
+				pipeCycles);
+		LOG_printf(&trace, "BENCH copy hidden: %d cycles/frame",
+				((copyCycles + computeCycles) > pipeCycles) ?
+						(copyCycles + computeCycles - pipeCycles) : 0);
+	}
+
+	if (src != NULL) {
+		MEM_free(DSPLINK_SEGID, src, RING_IO_BENCH_FRAMESIZE);
+	}
+	if (dst != NULL) {
+		MEM_free(DSPLINK_SEGID, dst, RING_IO_BENCH_FRAMESIZE);
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_benchPrefetch
+ *
+ *  @desc   Measures the cache stalls saved by prefetching the next span.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int RING_IO_benchPrefetch(Void) {
+	Int status = SYS_OK;
+	Char * ring = NULL;
+	Char * frame = NULL;
+	Char * next;
+	Uint32 start;
+	Uint32 n;
+	Uint32 coldCycles;
+	Uint32 warmCycles;
+
+	/* Two spans of the input RingIO, the current and the next one */
+	ring = MEM_calloc(DSPLINK_SEGID, 2u * RING_IO_BENCH_FRAMESIZE,
+			DSPLINK_BUF_ALIGN);
+	frame = MEM_calloc(DSPLINK_SEGID, RING_IO_BENCH_FRAMESIZE,
+			DSPLINK_BUF_ALIGN);
+	if ((ring == NULL) || (frame == NULL)) {
+		status = SYS_EALLOC;
+		SET_FAILURE_REASON(status);
+	}
+
+	if (status == SYS_OK) {
+		/* Next span read cold after the compute of the current frame */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			next = ring + RING_IO_MAUS((n & 1u) * RING_IO_BENCH_FRAMESIZE);
+			BCACHE_inv(next, RING_IO_BENCH_FRAMESIZE, TRUE);
+			RING_IO_scaleMulFactor((RING_IO_Mau *) frame,
+					RING_IO_MAUS(RING_IO_BENCH_FRAMESIZE));
+			RING_IO_copySwap(frame, 0, next, RING_IO_BENCH_FRAMESIZE,
+					RING_IO_BENCH_FRAMESIZE, RING_IO_FMT_NATIVE);
+		}
+		coldCycles = RING_IO_benchCycles(CLK_gethtime() - start);
+
+		/* Same, with the next span touched before the compute */
+		start = CLK_gethtime();
+		for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+			next = ring + RING_IO_MAUS((n & 1u) * RING_IO_BENCH_FRAMESIZE);
+			BCACHE_inv(next, RING_IO_BENCH_FRAMESIZE, TRUE);
+			RING_IO_prefetch(next, RING_IO_BENCH_FRAMESIZE);
+			RING_IO_scaleMulFactor((RING_IO_Mau *) frame,
+					RING_IO_MAUS(RING_IO_BENCH_FRAMESIZE));
+			RING_IO_copySwap(frame, 0, next, RING_IO_BENCH_FRAMESIZE,
+					RING_IO_BENCH_FRAMESIZE, RING_IO_FMT_NATIVE);
+		}
+		warmCycles = RING_IO_benchCycles(CLK_gethtime() - start);
+
+		LOG_printf(&trace, "BENCH prefetch cold: %d cycles/frame",
+				coldCycles);
+		LOG_printf(&trace, "BENCH prefetch touched: %d cycles/frame",
+				warmCycles);
+		LOG_printf(&trace, "BENCH prefetch stalls saved: %d cycles/frame",
+				(coldCycles > warmCycles) ? (coldCycles - warmCycles) : 0);
+	}
+
+	if (ring != NULL) {
+		MEM_free(DSPLINK_SEGID, ring, 2u * RING_IO_BENCH_FRAMESIZE);
+	}
+	if (frame != NULL) {
+		MEM_free(DSPLINK_SEGID, frame, RING_IO_BENCH_FRAMESIZE);
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_benchRingIo
+ *
+ *  @desc   Measures the cycle cost of each RingIO operation the frame loop
+ *          uses, for every cache flag combination and acquire size.
+ *
+ *  @modif  RING_IO_benchRingIoCosts
+ *  ============================================================================
+ */
+Int RING_IO_benchRingIo(Void) {
+	Int status = SYS_OK;
+	Int tmpStatus;
+	Bool created = FALSE;
+	RingIO_Attrs ringIoAttrs;
+	RING_IO_BenchRingIoCost * cost;
+	Uint32 flags;
+	Uint32 size;
+	Uint32 start;
+	Uint32 clockCost;
+	Uint32 n;
+	Uint32 i;
+	Uint32 j;
+
+	/* Cost of the CLK_gethtime() pair around each measured call */
+	start = CLK_gethtime();
+	for (n = 0; n < RING_IO_BENCH_ITERATIONS; n++) {
+		clockCost = CLK_gethtime();
+	}
+	clockCost = (CLK_gethtime() - start) / RING_IO_BENCH_ITERATIONS;
+
+	/* Room for two of the largest acquires, so no size wraps */
+	ringIoAttrs.transportType = RINGIO_TRANSPORT_GPP_DSP;
+	ringIoAttrs.ctrlPoolId = SAMPLE_POOL_ID;
+	ringIoAttrs.dataPoolId = SAMPLE_POOL_ID;
+	ringIoAttrs.attrPoolId = SAMPLE_POOL_ID;
+	ringIoAttrs.lockPoolId = SAMPLE_POOL_ID;
+	ringIoAttrs.dataBufSize = 2u * (RING_IO_BENCH_RINGIO_MINSIZE
+			<< (2u * (RING_IO_BENCH_RINGIO_SIZES - 1u)));
+	ringIoAttrs.footBufSize = 0;
+	ringIoAttrs.attrBufSize = RING_IO_attrBufSize;
+
+#if defined (DSPLINK_LEGACY_SUPPORT)
+	status = RingIO_create (RING_IO_BENCH_RINGIO_NAME, &ringIoAttrs);
+#else
+	status = RingIO_create(GBL_getProcId(), RING_IO_BENCH_RINGIO_NAME,
+			&ringIoAttrs);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+	if (status == SYS_OK) {
+		created = TRUE;
+	} else {
+		SET_FAILURE_REASON(status);
+	}
+
+	for (i = 0; (i < RING_IO_BENCH_RINGIO_FLAGS) && (status == SYS_OK); i++) {
+		flags = 0;
+		if ((i & 1u) != 0) {
+			flags |= RINGIO_DATABUF_CACHEUSE;
+		}
+		if ((i & 2u) != 0) {
+			flags |= RINGIO_ATTRBUF_CACHEUSE;
+		}
+		if ((i & 4u) != 0) {
+			flags |= RINGIO_CONTROL_CACHEUSE;
+		}
+
+		for (j = 0; (j < RING_IO_BENCH_RINGIO_SIZES) && (status == SYS_OK);
+				j++) {
+			size = RING_IO_BENCH_RINGIO_MINSIZE << (2u * j);
+			cost = &RING_IO_benchRingIoCosts[i][j];
+			status = RING_IO_benchRingIoRun(flags, size, clockCost, cost);
+			if (status == SYS_OK) {
+				LOG_printf(&trace, "BENCH ringio flags %d size %d", i, size);
+				LOG_printf(&trace, "BENCH  acquire w %d r %d",
+						cost->acquireWrite, cost->acquireRead);
+				LOG_printf(&trace, "BENCH  release w %d r %d",
+						cost->releaseWrite, cost->releaseRead);
+				LOG_printf(&trace, "BENCH  cancel %d validsize %d",
+						cost->cancel, cost->getValidSize);
+				LOG_printf(&trace, "BENCH  setattr %d setvattr %d",
+						cost->setAttribute, cost->setvAttribute);
+				LOG_printf(&trace, "BENCH  getattr %d getvattr %d",
+						cost->getAttribute, cost->getvAttribute);
+				LOG_printf(&trace, "BENCH  notify %d local callback %d",
+						cost->sendNotify, cost->localCallback);
+			}
+		}
+	}
+
+	if (created == TRUE) {
+#if defined (DSPLINK_LEGACY_SUPPORT)
+		tmpStatus = RingIO_delete (RING_IO_BENCH_RINGIO_NAME);
+#else
+		tmpStatus = RingIO_delete(GBL_getProcId(), RING_IO_BENCH_RINGIO_NAME);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+		if ((tmpStatus != SYS_OK) && (status == SYS_OK)) {
+			status = tmpStatus;
+			SET_FAILURE_REASON(status);
+		}
+	}
+
+	return (status);
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_benchRingIoRun
+ *
+ *  @desc   Measures the RingIO operations for one cache flag combination and
+ *          acquire size.
+ *
+ *  @modif  cost
+ *  ----------------------------------------------------------------------------
+ */
+static Int RING_IO_benchRingIoRun(Uint32 flags, Uint32 size, Uint32 clockCost,
+		RING_IO_BenchRingIoCost * cost) {
+	Int status = SYS_OK;
+	RingIO_Handle writer;
+	RingIO_Handle reader;
+	RingIO_BufPtr span;
+	Uint32 got;
+	Uint32 attr[1];
+	Uint32 attrSize;
+	Uint32 param;
+	Uint16 type;
+	Uint32 start;
+	Uint32 n;
+	Uint32 t[12];
+
+	writer = RingIO_open(RING_IO_BENCH_RINGIO_NAME, RINGIO_MODE_WRITE, flags);
+	reader = RingIO_open(RING_IO_BENCH_RINGIO_NAME, RINGIO_MODE_READ, flags);
+	if ((writer == NULL) || (reader == NULL)) {
+		status = RINGIO_EFAILURE;
+		SET_FAILURE_REASON(status);
+	}
+
+	/* The watermarks keep the data from triggering the notifiers */
+	if (status == SYS_OK) {
+		SEM_new(&RING_IO_benchPing, 0);
+		SEM_new(&RING_IO_benchPong, 0);
+		status = RingIO_setNotifier(reader, RINGIO_NOTIFICATION_ONCE,
+				0xFFFFFFFFu, &RING_IO_benchNotify,
+				(RingIO_NotifyParam) &RING_IO_benchPing);
+		if (status == RINGIO_SUCCESS) {
+			status = RingIO_setNotifier(writer, RINGIO_NOTIFICATION_ONCE,
+					0xFFFFFFFFu, &RING_IO_benchNotify,
+					(RingIO_NotifyParam) &RING_IO_benchPong);
+		}
+		if (status != RINGIO_SUCCESS) {
+			SET_FAILURE_REASON(status);
+		}
+	}
+
+	for (n = 0; n < 12u; n++) {
+		t[n] = 0;
+	}
+
+	/* One frame's worth of operations per iteration, in frame loop order.
+	 * Each call is checked on its own, so the failing status is returned.
+	 */
+	for (n = 0; (n < RING_IO_BENCH_ITERATIONS) && (status == SYS_OK); n++) {
+		start = CLK_gethtime();
+		status = RingIO_setAttribute(writer, 0, RING_IO_BENCH_ATTR, n);
+		t[0] += CLK_gethtime() - start;
+
+		if (status == RINGIO_SUCCESS) {
+			attr[0] = size;
+			start = CLK_gethtime();
+			status = RingIO_setvAttribute(writer, 0, 0, 0, attr,
+					sizeof(attr));
+			t[1] += CLK_gethtime() - start;
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			got = size;
+			start = CLK_gethtime();
+			status = RingIO_acquire(writer, &span, &got);
+			t[2] += CLK_gethtime() - start;
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			start = CLK_gethtime();
+			status = RingIO_release(writer, got);
+			t[3] += CLK_gethtime() - start;
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			got = size;
+			status = RingIO_acquire(writer, &span, &got);
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			start = CLK_gethtime();
+			status = RingIO_cancel(writer);
+			t[4] += CLK_gethtime() - start;
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			start = CLK_gethtime();
+			got = RingIO_getValidSize(reader);
+			t[5] += CLK_gethtime() - start;
+
+			start = CLK_gethtime();
+			status = RingIO_getAttribute(reader, &type, &param);
+			t[6] += CLK_gethtime() - start;
+			if (status == RINGIO_SPENDINGATTRIBUTE) {
+				status = RINGIO_SUCCESS;
+			}
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			attrSize = sizeof(attr);
+			start = CLK_gethtime();
+			status = RingIO_getvAttribute(reader, &type, &param, attr,
+					&attrSize);
+			t[7] += CLK_gethtime() - start;
+			if (status == RINGIO_SPENDINGATTRIBUTE) {
+				status = RINGIO_SUCCESS;
+			}
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			got = size;
+			start = CLK_gethtime();
+			status = RingIO_acquire(reader, &span, &got);
+			t[8] += CLK_gethtime() - start;
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			start = CLK_gethtime();
+			status = RingIO_release(reader, got);
+			t[9] += CLK_gethtime() - start;
+		}
+
+		if (status == RINGIO_SUCCESS) {
+			start = CLK_gethtime();
+			status = RingIO_sendNotify(writer, RING_IO_BENCH_ATTR);
+			t[10] += CLK_gethtime() - start;
+		}
+
+		if (status != RINGIO_SUCCESS) {
+			SET_FAILURE_REASON(status);
+		}
+	}
+
+	/* Local callback latency, once the sendNotify loop above has been
+	 * taken in. Both ends are on this DSP: no GPP round trip is measured
+	 * here, see gpp/ring_io_bench_host.c for that.
+	 */
+	if (status == SYS_OK) {
+		SEM_new(&RING_IO_benchPing, 0);
+		SEM_new(&RING_IO_benchPong, 0);
+		start = CLK_gethtime();
+		for (n = 0; (n < RING_IO_BENCH_ITERATIONS) && (status == SYS_OK);
+				n++) {
+			status = RingIO_sendNotify(writer, RING_IO_BENCH_ATTR);
+			if (status == RINGIO_SUCCESS) {
+				SEM_pend(&RING_IO_benchPing, SYS_FOREVER);
+				status = RingIO_sendNotify(reader, RING_IO_BENCH_ATTR);
+			}
+			if (status == RINGIO_SUCCESS) {
+				SEM_pend(&RING_IO_benchPong, SYS_FOREVER);
+			} else {
+				SET_FAILURE_REASON(status);
+			}
+		}
+		t[11] = CLK_gethtime() - start;
+	}
+
+	if (status == SYS_OK) {
+		for (n = 0; n < 11u; n++) {
+			/* Take out the clock reads, once per iteration */
+			t[n] = (t[n] > (clockCost * RING_IO_BENCH_ITERATIONS)) ?
+					(t[n] - (clockCost * RING_IO_BENCH_ITERATIONS)) : 0;
+		}
+		cost->setAttribute = RING_IO_benchCycles(t[0]);
+		cost->setvAttribute = RING_IO_benchCycles(t[1]);
+		cost->acquireWrite = RING_IO_benchCycles(t[2]);
+		cost->releaseWrite = RING_IO_benchCycles(t[3]);
+		cost->cancel = RING_IO_benchCycles(t[4]);
+		cost->getValidSize = RING_IO_benchCycles(t[5]);
+		cost->getAttribute = RING_IO_benchCycles(t[6]);
+		cost->getvAttribute = RING_IO_benchCycles(t[7]);
+		cost->acquireRead = RING_IO_benchCycles(t[8]);
+		cost->releaseRead = RING_IO_benchCycles(t[9]);
+		cost->sendNotify = RING_IO_benchCycles(t[10]);
+		cost->localCallback = RING_IO_benchCycles(t[11]);
+	}
+
+	if (writer != NULL) {
+		RingIO_close(writer);
+	}
+	if (reader != NULL) {
+		RingIO_close(reader);
+	}
+
+	return (status);
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_benchNotify
+ *
+ *  @desc   Notifier of the benchmark RingIO ends.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Void RING_IO_benchNotify(RingIO_Handle handle, RingIO_NotifyParam param,
+		RingIO_NotifyMsg msg) {
+	(Void) handle;
+	(Void) msg;
+
+	SEM_post((SEM_Handle) param);
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_benchCycles
+ *
+ *  @desc   Converts the CLK_gethtime() counts spent on RING_IO_BENCH_ITERATIONS
+ *          frames to CPU cycles per frame.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 RING_IO_benchCycles(Uint32 elapsed) {
+	return ((Uint32) (((Float) elapsed * CLK_cpuCyclesPerHtime())
+			/ (Float) RING_IO_BENCH_ITERATIONS));
+}
+
+#endif /* if defined (RING_IO_BENCH) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
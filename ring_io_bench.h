@@ -0,0 +1,260 @@
+/** ============================================================================
+ *  @file   ring_io_bench.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   On-target microbenchmarks of the RING_IO sample, built when
+ *          RING_IO_BENCH is defined. Results are reported on the trace LOG.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_BENCH_)
+#define RING_IO_BENCH_
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_BENCH_ITERATIONS
+ *
+ *  @desc   Number of frames run through each benchmarked path.
+ *  ============================================================================
+ */
+#define RING_IO_BENCH_ITERATIONS   1000u
+
+/** ============================================================================
+ *  @const  RING_IO_BENCH_FRAMESIZE
+ *
+ *  @desc   Frame size in bytes used by the benchmarks.
+ *  ============================================================================
+ */
+#define RING_IO_BENCH_FRAMESIZE    1024u
+
+/** ============================================================================
+ *  @const  RING_IO_BENCH_RINGIO_FLAGS
+ *
+ *  @desc   Number of RingIO cache flag combinations measured by
+ *          RING_IO_benchRingIo. Combination i sets RINGIO_DATABUF_CACHEUSE
+ *          if bit 0 of i is set, RINGIO_ATTRBUF_CACHEUSE for bit 1 and
+ *          RINGIO_CONTROL_CACHEUSE for bit 2.
+ *  ============================================================================
+ */
+#define RING_IO_BENCH_RINGIO_FLAGS   8u
+
+/** ============================================================================
+ *  @const  RING_IO_BENCH_RINGIO_SIZES, RING_IO_BENCH_RINGIO_MINSIZE
+ *
+ *  @desc   Number of acquire sizes measured by RING_IO_benchRingIo, and the
+ *          smallest one. Size j is RING_IO_BENCH_RINGIO_MINSIZE times 4 to
+ *          the power j: 64, 256, 1024 and 4096 bytes.
+ *  ============================================================================
+ */
+#define RING_IO_BENCH_RINGIO_SIZES   4u
+#define RING_IO_BENCH_RINGIO_MINSIZE 64u
+
+/** ============================================================================
+ *  @name   RING_IO_BenchRingIoCost
+ *
+ *  @desc   Cycles per call of each RingIO operation used by the frame loop,
+ *          for one cache flag combination and acquire size. The cost of
+ *          reading the clock is taken out.
+ *
+ *  @field  acquireWrite
+ *              RingIO_acquire by the writer.
+ *  @field  releaseWrite
+ *              RingIO_release by the writer.
+ *  @field  cancel
+ *              RingIO_cancel of a writer acquire.
+ *  @field  setAttribute
+ *              RingIO_setAttribute.
+ *  @field  setvAttribute
+ *              RingIO_setvAttribute with the one word size attribute.
+ *  @field  getAttribute
+ *              RingIO_getAttribute of a fixed attribute.
+ *  @field  getvAttribute
+ *              RingIO_getvAttribute of the size attribute.
+ *  @field  acquireRead
+ *              RingIO_acquire by the reader.
+ *  @field  releaseRead
+ *              RingIO_release by the reader.
+ *  @field  getValidSize
+ *              RingIO_getValidSize.
+ *  @field  sendNotify
+ *              RingIO_sendNotify, notifier of the other end included.
+ *  @field  localCallback
+ *              Local callback latency: a message to the reader end and the
+ *              reply to the writer end, each picked up by the benchmark task
+ *              through a semaphore. Both ends are on the DSP, so no GPP is
+ *              involved; the round trip through a GPP thread is measured on
+ *              the host by gpp/ring_io_bench_host.c.
+ *  ============================================================================
+ */
+typedef struct RING_IO_BenchRingIoCost_tag {
+    Uint32   acquireWrite ;
+    Uint32   releaseWrite ;
+    Uint32   cancel ;
+    Uint32   setAttribute ;
+    Uint32   setvAttribute ;
+    Uint32   getAttribute ;
+    Uint32   getvAttribute ;
+    Uint32   acquireRead ;
+    Uint32   releaseRead ;
+    Uint32   getValidSize ;
+    Uint32   sendNotify ;
+    Uint32   localCallback ;
+} RING_IO_BenchRingIoCost ;
+
+/** ============================================================================
+ *  @name   RING_IO_benchRingIoCosts
+ *
+ *  @desc   Results of RING_IO_benchRingIo, indexed by cache flag combination
+ *          and acquire size.
+ *  ============================================================================
+ */
+extern RING_IO_BenchRingIoCost
+       RING_IO_benchRingIoCosts [RING_IO_BENCH_RINGIO_FLAGS]
+                                [RING_IO_BENCH_RINGIO_SIZES] ;
+
+/** ============================================================================
+ *  @func   RING_IO_benchKernels
+ *
+ *  @desc   Compares the cycles per frame of the generic scale kernel
+ *          (RING_IO_apply) with the compile-time specialised kernels, both
+ *          over whole frames and over RING_IO_STAGE_BLOCKSIZE blocks with a
+ *          constant trip count.
+ *
+ *  @arg    None
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          SYS_EALLOC
+ *              Failed to allocate the benchmark buffer.
+ *
+ *  @enter  DSP/BIOS is running (called from task context).
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_DEFINE_SCALE_KERNEL
+ *  ============================================================================
+ */
+Int RING_IO_benchKernels (Void) ;
+
+/** ============================================================================
+ *  @func   RING_IO_benchCopy
+ *
+ *  @desc   Measures how much of the input copy the RING_IO_copy engine hides
+ *          behind the stages: copy alone, compute alone, and a pipelined
+ *          loop that computes block N while block N + 1 is copied.
+ *
+ *  @arg    None
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          SYS_EALLOC
+ *              Failed to allocate the benchmark buffers.
+ *
+ *  @enter  DSP/BIOS is running (called from task context), the RING_IO
+ *          tasks are not yet using copy engine 0.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_copySubmit
+ *  ============================================================================
+ */
+Int RING_IO_benchCopy (Void) ;
+
+/** ============================================================================
+ *  @func   RING_IO_benchPrefetch
+ *
+ *  @desc   Measures the cache stalls RING_IO_prefetch saves the reader, in
+ *          the order of the frame loop with RING_IO_PREFETCH: the next span
+ *          is invalidated as the GPP has just released it, the current
+ *          frame is computed, then the next span is copied. This runs once
+ *          as is and once with the next span touched before the compute.
+ *
+ *  @arg    None
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          SYS_EALLOC
+ *              Failed to allocate the benchmark buffers.
+ *
+ *  @enter  DSP/BIOS is running (called from task context).
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_prefetch
+ *  ============================================================================
+ */
+Int RING_IO_benchPrefetch (Void) ;
+
+/** ============================================================================
+ *  @func   RING_IO_benchRingIo
+ *
+ *  @desc   Measures the cycle cost of each RingIO operation the frame loop
+ *          uses, for every cache flag combination and acquire size, on a
+ *          RingIO with both ends opened by this DSP. This is a DSP-only
+ *          benchmark: the notify ping-pong never crosses to the GPP and only
+ *          gives the local callback latency; the GPP-DSP round trip comes
+ *          from gpp/ring_io_bench_host.c. Results are kept
+ *          in RING_IO_benchRingIoCosts and reported on the trace LOG.
+ *
+ *  @arg    None
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  DSP/BIOS is running (called from task context), POOL and
+ *          RING_IO_attrBufSize are set up.
+ *
+ *  @leave  The benchmark RingIO is deleted.
+ *
+ *  @see    RING_IO_BenchRingIoCost
+ *  ============================================================================
+ */
+Int RING_IO_benchRingIo (Void) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+#endif /* !defined (RING_IO_BENCH_) */
@@ -42,6 +42,8 @@
 
 /* ---------------------------- DSP/BIOS Headers ----------------------------- */
 #include <std.h>
+#include <sys.h>
+#include <mem.h>
 #include <pool.h>
 
 /*  --------------------------- DSP/BIOS LINK Headers ----------------------- */
@@ -71,7 +73,7 @@ extern "C" {
  *  @desc   Number of pools configured in the system.
  *  ============================================================================
  */
-#define NUM_POOLS           1u
+#define NUM_POOLS           2u
 
 /** ============================================================================
  *  @const  SAMPLEPOOL_PARAMS, SAMPLEPOOL_FXNS, SAMPLEPOOL_init
@@ -100,6 +102,35 @@ SMAPOOL_Params SamplePoolParams =
 } ;
 #endif /* if ((PHYINTERFACE == PCI_INTERFACE) || (PHYINTERFACE == VLYNQ_INTERFACE)) */
 
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_localPoolInit, RING_IO_localPoolOpen,
+ *          RING_IO_localPoolClose, RING_IO_localPoolAlloc,
+ *          RING_IO_localPoolFree
+ *
+ *  @desc   POOL interface of LOCAL_POOL_ID: buffers are allocated from
+ *          RING_IO_SELFTEST_SEGID with MEM, aligned as the sample pool.
+ *  ----------------------------------------------------------------------------
+ */
+static Void RING_IO_localPoolInit(Void);
+static Int RING_IO_localPoolOpen(Ptr * object, Ptr params);
+static Void RING_IO_localPoolClose(Ptr object);
+static Int RING_IO_localPoolAlloc(Ptr object, Ptr * buf, size_t size);
+static Void RING_IO_localPoolFree(Ptr object, Ptr buf, size_t size);
+
+/** ============================================================================
+ *  @name   RING_IO_LocalPoolFxns
+ *
+ *  @desc   Interface functions of LOCAL_POOL_ID.
+ *  ============================================================================
+ */
+static POOL_Fxns RING_IO_LocalPoolFxns =
+{
+    &RING_IO_localPoolOpen,
+    &RING_IO_localPoolClose,
+    &RING_IO_localPoolAlloc,
+    &RING_IO_localPoolFree
+} ;
+
 
 /** ============================================================================
  *  @name   RING_IO_Pools
@@ -110,15 +141,21 @@ SMAPOOL_Params SamplePoolParams =
 POOL_Obj RING_IO_Pools [NUM_POOLS] =
 {
 #if defined (DSP_BOOTMODE_NOBOOT)
-    POOL_NOENTRY
+    POOL_NOENTRY,
 #else
     {
         &SAMPLEPOOL_init,               /* Init Function                      */
         (POOL_Fxns *) &SAMPLEPOOL_FXNS, /* Pool interface functions           */
         &SAMPLEPOOL_PARAMS,              /* Pool params                        */
         NULL                            /* Pool object: Set within pool impl. */
-    }
+    },
 #endif
+    {
+        &RING_IO_localPoolInit,         /* Init Function                      */
+        &RING_IO_LocalPoolFxns,         /* Pool interface functions           */
+        NULL,                           /* Pool params                        */
+        NULL                            /* Pool object: Set within pool impl. */
+    }
 } ;
 
 /** ============================================================================
@@ -131,6 +168,84 @@ POOL_Obj RING_IO_Pools [NUM_POOLS] =
 POOL_Config POOL_config = {RING_IO_Pools, NUM_POOLS} ;
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_localPoolInit
+ *
+ *  @desc   Initializes the local pool. Nothing to do.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Void RING_IO_localPoolInit(Void)
+{
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_localPoolOpen
+ *
+ *  @desc   Opens the local pool. It keeps no state.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Int RING_IO_localPoolOpen(Ptr * object, Ptr params)
+{
+    *object = params ;
+
+    return (SYS_OK) ;
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_localPoolClose
+ *
+ *  @desc   Closes the local pool.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Void RING_IO_localPoolClose(Ptr object)
+{
+    (Void) object ;
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_localPoolAlloc
+ *
+ *  @desc   Allocates a buffer from RING_IO_SELFTEST_SEGID.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Int RING_IO_localPoolAlloc(Ptr object, Ptr * buf, size_t size)
+{
+    Int status = SYS_OK ;
+
+    (Void) object ;
+
+    *buf = MEM_alloc(RING_IO_SELFTEST_SEGID, size, DSPLINK_BUF_ALIGN) ;
+    if (*buf == NULL) {
+        status = SYS_EALLOC ;
+    }
+
+    return (status) ;
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_localPoolFree
+ *
+ *  @desc   Frees a buffer of the local pool.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Void RING_IO_localPoolFree(Ptr object, Ptr buf, size_t size)
+{
+    (Void) object ;
+
+    MEM_free(RING_IO_SELFTEST_SEGID, buf, size) ;
+}
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
@@ -57,6 +57,16 @@ extern "C" {
  */
 #define SAMPLE_POOL_ID        0u
 
+/** ============================================================================
+ *  @name   LOCAL_POOL_ID
+ *
+ *  @desc   ID of the pool of the DSP-local RingIOs of the self-test. Its
+ *          buffers come from RING_IO_SELFTEST_SEGID, not from the memory
+ *          shared with the GPP.
+ *  ============================================================================
+ */
+#define LOCAL_POOL_ID         1u
+
 /** ============================================================================
  *  @const  RING_IO_READER_NAME
  *
@@ -75,6 +85,418 @@ extern "C" {
 #define RING_IO_WRITER_NAME1   "RINGIO2"
 #define RING_IO_WRITER_NAME2   "RINGIO4"
 
+/** ============================================================================
+ *  @const  RING_IO_PLACE
+ *
+ *  @desc   DSPs serving each channel, see ring_io_place.h:
+ *          RING_IO_PLACE_LOCAL, RING_IO_PLACE_EACH or a processor ID. The
+ *          RingIO names above are the base names of the channels that are
+ *          not local.
+ *  ============================================================================
+ */
+#define RING_IO_PLACE1         RING_IO_PLACE_LOCAL
+#define RING_IO_PLACE2         RING_IO_PLACE_LOCAL
+
+/** ============================================================================
+ *  @const  RING_IO_SHED_POLICY
+ *
+ *  @desc   Load shedding policy applied by each channel when overloaded.
+ *          Shedding is opt-in: it needs a policy and RING_IO_SHED_DEADLINE.
+ *  ============================================================================
+ */
+#define RING_IO_SHED_POLICY1   SHED_POLICY_NONE
+#define RING_IO_SHED_POLICY2   SHED_POLICY_NONE
+
+/** ============================================================================
+ *  @const  RING_IO_SHED_NTH
+ *
+ *  @desc   Frame interval used by SHED_POLICY_DROP_NTH.
+ *  ============================================================================
+ */
+#define RING_IO_SHED_NTH1      4u
+#define RING_IO_SHED_NTH2      4u
+
+/** ============================================================================
+ *  @const  RING_IO_SHED_FILLMARK
+ *
+ *  @desc   Reader RingIO fill level (percent) at or above which the channel
+ *          becomes overloaded, if the frames are also late (see
+ *          RING_IO_SHED_DEADLINE). A full ring alone is not an overload.
+ *          0 disables the fill check.
+ *  ============================================================================
+ */
+#define RING_IO_SHED_FILLMARK1 75u
+#define RING_IO_SHED_FILLMARK2 75u
+
+/** ============================================================================
+ *  @const  RING_IO_SHED_LOWMARK
+ *
+ *  @desc   Reader RingIO fill level (percent) down to which an overloaded
+ *          channel keeps shedding. SHED_POLICY_DROP_OLDEST so drops only the
+ *          backlog above this mark. Must be below RING_IO_SHED_FILLMARK.
+ *  ============================================================================
+ */
+#define RING_IO_SHED_LOWMARK1  50u
+#define RING_IO_SHED_LOWMARK2  50u
+
+/** ============================================================================
+ *  @const  RING_IO_SHED_DEADLINE
+ *
+ *  @desc   Per-frame deadline in microseconds. Frames are late after
+ *          RING_IO_SHED_MISSLIMIT consecutive misses, or when the input
+ *          backlog at the current frame period would take longer than the
+ *          deadline to drain. 0 disables the check, and so the shedding.
+ *  ============================================================================
+ */
+#define RING_IO_SHED_DEADLINE1 0u
+#define RING_IO_SHED_DEADLINE2 0u
+
+/** ============================================================================
+ *  @const  RING_IO_SHED_MISSLIMIT
+ *
+ *  @desc   Consecutive deadline misses that signal an overload.
+ *  ============================================================================
+ */
+#define RING_IO_SHED_MISSLIMIT 3u
+
+/** ============================================================================
+ *  @const  RING_IO_DEGRADE_LOADHI, RING_IO_DEGRADE_LOADLO
+ *
+ *  @desc   Stage load (percent of the frame period) at which each channel
+ *          switches to the fallback stage variants, and below which it
+ *          switches back.
+ *  ============================================================================
+ */
+#define RING_IO_DEGRADE_LOADHI1 85u
+#define RING_IO_DEGRADE_LOADHI2 85u
+#define RING_IO_DEGRADE_LOADLO1 60u
+#define RING_IO_DEGRADE_LOADLO2 60u
+
+/** ============================================================================
+ *  @const  RING_IO_DEGRADE_FILLHI, RING_IO_DEGRADE_FILLLO
+ *
+ *  @desc   Reader RingIO fill level (percent) at which each channel switches
+ *          to the fallback stage variants, and below which it switches back.
+ *          Kept under RING_IO_SHED_FILLMARK so degradation precedes shedding.
+ *  ============================================================================
+ */
+#define RING_IO_DEGRADE_FILLHI1 50u
+#define RING_IO_DEGRADE_FILLHI2 50u
+#define RING_IO_DEGRADE_FILLLO1 25u
+#define RING_IO_DEGRADE_FILLLO2 25u
+
+/** ============================================================================
+ *  @const  RING_IO_JITTER_DELAY
+ *
+ *  @desc   Minimum jitter buffer delay in microseconds. Frames are held in the
+ *          reader RingIO for at least this long before being consumed.
+ *          0 disables the jitter buffer.
+ *  ============================================================================
+ */
+#define RING_IO_JITTER_DELAY1    0u
+#define RING_IO_JITTER_DELAY2    0u
+
+/** ============================================================================
+ *  @const  RING_IO_JITTER_MAXDELAY
+ *
+ *  @desc   Maximum jitter buffer delay in microseconds.
+ *  ============================================================================
+ */
+#define RING_IO_JITTER_MAXDELAY1 20000u
+#define RING_IO_JITTER_MAXDELAY2 20000u
+
+/** ============================================================================
+ *  @const  RING_IO_BUDGET
+ *
+ *  @desc   Processing budget of each channel in CPU cycles per frame.
+ *          0 disables budget accounting.
+ *  ============================================================================
+ */
+#define RING_IO_BUDGET1        0u
+#define RING_IO_BUDGET2        0u
+
+/** ============================================================================
+ *  @const  RING_IO_BUDGET_ABORT
+ *
+ *  @desc   If TRUE, processing of a frame stops at the first block boundary
+ *          past the budget so that the other channel keeps its share.
+ *  ============================================================================
+ */
+#define RING_IO_BUDGET_ABORT1  FALSE
+#define RING_IO_BUDGET_ABORT2  FALSE
+
+/** ============================================================================
+ *  @const  RING_IO_STAGE_BLOCKSIZE
+ *
+ *  @desc   Block size in bytes in which the processing stages run over a
+ *          frame. The budget is checked at every block boundary.
+ *  ============================================================================
+ */
+#define RING_IO_STAGE_BLOCKSIZE 256u
+
+/** ============================================================================
+ *  @const  RING_IO_READ_GREEDY
+ *
+ *  @desc   If TRUE, each reader acquire asks for all valid data in the input
+ *          RingIO up to the rest of the frame instead of the size announced
+ *          by the GPP, so a GPP that ran ahead is drained in one acquire.
+ *          Opt-in per channel.
+ *  ============================================================================
+ */
+#define RING_IO_READ_GREEDY1   FALSE
+#define RING_IO_READ_GREEDY2   FALSE
+
+/** ============================================================================
+ *  @const  RING_IO_WRITER_FLEXIBLE
+ *
+ *  @desc   If TRUE, the output RingIO is opened without
+ *          RINGIO_NEED_EXACT_SIZE and the writer accepts a partial acquire,
+ *          fills it and continues with the rest of the frame, instead of
+ *          waiting until the full acquire size is free. Opt-in per channel.
+ *  ============================================================================
+ */
+#define RING_IO_WRITER_FLEXIBLE1   FALSE
+#define RING_IO_WRITER_FLEXIBLE2   FALSE
+
+/** ============================================================================
+ *  @const  RING_IO_ACQ_GRANULE
+ *
+ *  @desc   Granule in bytes to which reader and writer acquires are rounded
+ *          down, so that every acquired buffer starts on a granule boundary.
+ *          The reader also releases short acquires, at the wrap or before
+ *          an attribute, in whole granules and cancels the rest, which the
+ *          next acquire takes again. Only the last piece of a frame or
+ *          segment may break it, a piece shorter than a granule, and a
+ *          partial acquire of a flexible writer at the wrap, which is
+ *          released as it is. 0 disables the rounding; set the C64x+ L2
+ *          cache line, 128, to opt a channel in.
+ *  ============================================================================
+ */
+#define RING_IO_ACQ_GRANULE1   0u
+#define RING_IO_ACQ_GRANULE2   0u
+
+/** ============================================================================
+ *  @const  RING_IO_NOTIFY_FRAMES, RING_IO_NOTIFY_BYTES, RING_IO_NOTIFY_PERIOD
+ *
+ *  @desc   Moderation of the output notifications to the GPP. The end of
+ *          frame notification is sent once NOTIFY_FRAMES frames or
+ *          NOTIFY_BYTES bytes are pending, or NOTIFY_PERIOD microseconds
+ *          after the first pending frame, whichever comes first. With
+ *          moderation on, start of frame notifications are folded into the
+ *          end of frame one: the GPP reader finds the start attribute ahead
+ *          of the frame data when it is woken. A NOTIFY_FRAMES of 1 with
+ *          NOTIFY_BYTES of 0 notifies every start and end of frame.
+ *          The GPP reader must drain all available frames on a notification
+ *          when moderation is on.
+ *          NOTIFY_PERIOD needs the PRD_ringIoNotify timer, which ring_io.tci
+ *          creates only when ringIoNotifyTimer is set there. 0 for no timer.
+ *          The timer only wakes the channel task, which sends the
+ *          notification when it is idle or at its next end of frame.
+ *  ============================================================================
+ */
+#define RING_IO_NOTIFY_FRAMES1   1u
+#define RING_IO_NOTIFY_FRAMES2   1u
+#define RING_IO_NOTIFY_BYTES1    0u
+#define RING_IO_NOTIFY_BYTES2    0u
+#define RING_IO_NOTIFY_PERIOD1   0u
+#define RING_IO_NOTIFY_PERIOD2   0u
+
+/** ============================================================================
+ *  @const  RING_IO_SAMPLE_FORMAT
+ *
+ *  @desc   Byte order of the input samples (RING_IO_FMT_NATIVE,
+ *          RING_IO_FMT_BE16 or RING_IO_FMT_BE32) until the GPP sends a
+ *          RINGIO_DATA_FORMAT attribute.
+ *  ============================================================================
+ */
+#define RING_IO_SAMPLE_FORMAT1   0u
+#define RING_IO_SAMPLE_FORMAT2   0u
+
+/** ============================================================================
+ *  @const  RING_IO_ASYNC_COPY
+ *
+ *  @desc   Copy the input through the channel's RING_IO_copy engine and run
+ *          the stages on the blocks already copied while the next chunk is
+ *          in flight. Only applies to native byte order input, and only in
+ *          the RING_IO_EDMA3 build and the host build (RING_IO_COPY_OVERLAP);
+ *          otherwise the input is copied by the CPU as with FALSE.
+ *  ============================================================================
+ */
+#define RING_IO_ASYNC_COPY1      TRUE
+#define RING_IO_ASYNC_COPY2      TRUE
+
+/** ============================================================================
+ *  @const  RING_IO_PREFETCH
+ *
+ *  @desc   If TRUE, the reader touches the next pending span of the input
+ *          RingIO with RING_IO_prefetch while the current one is copied
+ *          and processed. The span follows the read position in the data
+ *          buffer, up to RingIO_getValidSize; it is found once the reader
+ *          has wrapped around the buffer once. An acquire would invalidate
+ *          the touched lines again, so the input RingIO is then opened
+ *          without RINGIO_DATABUF_CACHEUSE and the reader invalidates the
+ *          spans itself. The GPP must create the input RingIO without a
+ *          foot buffer.
+ *  ============================================================================
+ */
+#define RING_IO_PREFETCH1        FALSE
+#define RING_IO_PREFETCH2        FALSE
+
+/** ============================================================================
+ *  @const  RING_IO_REPEAT_CHECK, RING_IO_REPEAT_ATTR
+ *
+ *  @desc   Repeated frame check. With RING_IO_REPEAT_CHECK set, a frame
+ *          whose content, size and scale parameters equal those of the last
+ *          processed frame skips the stages. The content is compared in full
+ *          when the hashes match, against a copy of the last input. Its
+ *          cached output is sent again, or with RING_IO_REPEAT_ATTR set, a
+ *          RINGIO_DATA_REPEAT attribute is sent in place of the data and no
+ *          output is cached. The GPP reader must understand that attribute.
+ *          The check takes two frame buffers per channel.
+ *  ============================================================================
+ */
+#define RING_IO_REPEAT_CHECK1    FALSE
+#define RING_IO_REPEAT_CHECK2    FALSE
+#define RING_IO_REPEAT_ATTR1     FALSE
+#define RING_IO_REPEAT_ATTR2     FALSE
+
+/** ============================================================================
+ *  @const  RING_IO_PACK_ATTRS
+ *
+ *  @desc   Packed output attributes. With it set, the start attribute of a
+ *          frame, its shed, pass or repeat mark and the size of its first
+ *          chunk go out as one RINGIO_DATA_PACKED attribute, each further
+ *          chunk as a record with its size, and the end of the frame in the
+ *          record of its last chunk. A frame without data is a single
+ *          record. The GPP reader must understand packed records. Packed
+ *          records from the GPP are accepted either way. A frame sent in one
+ *          chunk takes a single attribute buffer entry.
+ *  ============================================================================
+ */
+#define RING_IO_PACK_ATTRS1      FALSE
+#define RING_IO_PACK_ATTRS2      FALSE
+
+/** ============================================================================
+ *  @const  RING_IO_ATTR_HDR_SIZE, RING_IO_PACK_ATTR_ENTRIES,
+ *          RING_IO_PACK_ATTRBUF_SIZE
+ *
+ *  @desc   Attribute buffer of the output RingIOs when both channels pack
+ *          their attributes. An entry takes a variable attribute header of
+ *          at most RING_IO_ATTR_HDR_SIZE bytes and a full packed record. The
+ *          buffer holds RING_IO_PACK_ATTR_ENTRIES entries, as many frames
+ *          sent in one chunk, where unpacked frames take three entries each
+ *          out of 2048 bytes.
+ *  ============================================================================
+ */
+#define RING_IO_ATTR_HDR_SIZE        32u
+#define RING_IO_PACK_ATTR_ENTRIES    16u
+#define RING_IO_PACK_ATTRBUF_SIZE                                              \
+        (RING_IO_PACK_ATTR_ENTRIES                                             \
+         * (RING_IO_ATTR_HDR_SIZE + (RING_IO_PACK_WORDS * sizeof (Uint32))))
+
+/** ============================================================================
+ *  @const  RING_IO_SELFTEST_FRAMES, RING_IO_SELFTEST_FRAMESIZE
+ *
+ *  @desc   Number and size in bytes of the frames generated by the loopback
+ *          self-test (NOTIFY_DSP_SELFTEST). Its local RingIOs hold two
+ *          frames each.
+ *  ============================================================================
+ */
+#define RING_IO_SELFTEST_FRAMES     256u
+#define RING_IO_SELFTEST_FRAMESIZE  4096u
+
+/** ============================================================================
+ *  @const  RING_IO_SELFTEST_SEGID
+ *
+ *  @desc   Memory segment of the self-test RingIOs, through LOCAL_POOL_ID.
+ *          DSPLINK_SEGID is the heap of the DSP image, outside the pool
+ *          memory shared with the GPP.
+ *  ============================================================================
+ */
+#define RING_IO_SELFTEST_SEGID      DSPLINK_SEGID
+
+/** ============================================================================
+ *  @const  RING_IO_TABLE_SEGID
+ *
+ *  @desc   Memory segment of the shared table cache, see ring_io_tables.h.
+ *          With RING_IO_TABLE_IRAM, set by DspBios/COMPONENT, it is the
+ *          RING_IO_TABLE_HEAP heap that ringIoTableHeap() of ring_io.tci
+ *          creates in IRAM. That covers the DSP/BIOS 5.XX DM6437, DM6467GEM,
+ *          DM648, OMAP3530, OMAPL138GEM and OMAPL1XXGEM platforms, whose
+ *          cache profile leaves part of L2 as IRAM.
+ *          The other 5.XX platforms use all of L2 as cache, and the 6.XX
+ *          platforms have no such heap: there the tables come from
+ *          DSPLINK_SEGID in external memory and are read through the cache.
+ *  ============================================================================
+ */
+#if defined (RING_IO_TABLE_IRAM)
+extern Int RING_IO_TABLE_HEAP;
+#define RING_IO_TABLE_SEGID      RING_IO_TABLE_HEAP
+#else
+#define RING_IO_TABLE_SEGID      DSPLINK_SEGID
+#endif /* if defined (RING_IO_TABLE_IRAM) */
+
+#if defined (RING_IO_EDMA3)
+/** ============================================================================
+ *  @const  RING_IO_EDMA3_CC_BASE, RING_IO_EDMA3_QCHAN, RING_IO_EDMA3_PARAM,
+ *          RING_IO_EDMA3_TCC, RING_IO_EDMA3_GLOBAL_OFFSET
+ *
+ *  @desc   EDMA3 resources of the copy engines (RING_IO_EDMA3 build). Engine
+ *          n uses QDMA channel QCHAN + n, PaRAM set PARAM + n and transfer
+ *          completion code TCC + n; these must not be used by other
+ *          software on the DSP. GLOBAL_OFFSET converts local L1/L2
+ *          addresses to global addresses.
+ *  ============================================================================
+ */
+#define RING_IO_EDMA3_CC_BASE       0x01C00000u
+#define RING_IO_EDMA3_QCHAN         6u
+#define RING_IO_EDMA3_PARAM         126u
+#define RING_IO_EDMA3_TCC           30u
+#define RING_IO_EDMA3_GLOBAL_OFFSET (RING_IO_EDMA3_L2_GLOBAL - 0x00800000u)
+
+/** ============================================================================
+ *  @const  RING_IO_EDMA3_L2_GLOBAL
+ *
+ *  @desc   Global address of L2, local address 0x00800000, and so of the
+ *          device's GLOBAL_OFFSET. RING_IO_EDMA3_CORE1 is set by
+ *          DspBios/COMPONENT for the devices whose DSP is core 1 of the
+ *          memory map (DM6446, DM6467, OMAPL138/DA8xx and OMAPL1xx); the
+ *          others see the DSP as core 0.
+ *  ============================================================================
+ */
+#if defined (RING_IO_EDMA3_CORE1)
+#define RING_IO_EDMA3_L2_GLOBAL     0x11800000u
+#else
+#define RING_IO_EDMA3_L2_GLOBAL     0x10800000u
+#endif /* if defined (RING_IO_EDMA3_CORE1) */
+#endif /* if defined (RING_IO_EDMA3) */
+
+#if defined (RING_IO_FIXED_CONFIG)
+/** ============================================================================
+ *  @const  RING_IO_FIXED_FRAMESIZE, RING_IO_FIXED_OPCODE, RING_IO_FIXED_FACTOR
+ *
+ *  @desc   Channel configuration of the single configuration build
+ *          (RING_IO_FIXED_CONFIG). Every channel uses this frame size, scale
+ *          operation and factor; the values from the GPP are ignored.
+ *          The frame size must be a multiple of RING_IO_STAGE_BLOCKSIZE.
+ *  ============================================================================
+ */
+#define RING_IO_FIXED_FRAMESIZE 1024u
+#define RING_IO_FIXED_OPCODE    OP_MULTIPLY
+#define RING_IO_FIXED_FACTOR    OP_FACTOR
+
+/** ============================================================================
+ *  @const  RING_IO_FIXED_STAGES
+ *
+ *  @desc   Stage list of the single configuration build, applied to each
+ *          RING_IO_STAGE_BLOCKSIZE block of a full frame.
+ *  ============================================================================
+ */
+#define RING_IO_FIXED_STAGES(block)                                            \
+        RING_IO_scaleFixed ((RING_IO_Mau *) (block),                           \
+                            RING_IO_MAUS (RING_IO_STAGE_BLOCKSIZE))
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+
 
 #if defined (__cplusplus)
 }
@@ -0,0 +1,471 @@
+/** ============================================================================
+ *  @file   ring_io_copy.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Asynchronous copy engine of the RING_IO sample.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+/* ---------------------------- DSP/BIOS Headers ---------------------------- */
+#if defined (RING_IO_LOCAL)
+/* Host build, see gpp/ring_io_bench_host.c */
+#include <ring_io_local.h>
+#else /* if defined (RING_IO_LOCAL) */
+#include <std.h>
+#endif /* if defined (RING_IO_LOCAL) */
+#if defined (RING_IO_EDMA3)
+#include <bcache.h>
+#endif /* if defined (RING_IO_EDMA3) */
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <string.h>
+#if defined (RING_IO_LOCAL)
+#include <pthread.h>
+#endif /* if defined (RING_IO_LOCAL) */
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_config.h>
+#include <ring_io_copy.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+#if defined (RING_IO_EDMA3)
+/*  ============================================================================
+ *  @macro  EDMA3_*
+ *
+ *  @desc   EDMA3 channel controller registers used by the QDMA backend,
+ *          as offsets from RING_IO_EDMA3_CC_BASE.
+ *  ============================================================================
+ */
+#define EDMA3_REG(offset)   (*(volatile Uint32 *) (RING_IO_EDMA3_CC_BASE \
+                                                   + (offset)))
+#define EDMA3_QCHMAP(n)     (0x0200u + (4u * (n)))
+#define EDMA3_QEESR         0x028Cu
+#define EDMA3_IPR           0x1068u
+#define EDMA3_ICR           0x1070u
+#define EDMA3_PARAM(n)      (0x4000u + (32u * (n)))
+
+#define EDMA3_PARAM_OPT     0x00u
+#define EDMA3_PARAM_SRC     0x04u
+#define EDMA3_PARAM_ABCNT   0x08u
+#define EDMA3_PARAM_DST     0x0Cu
+#define EDMA3_PARAM_BIDX    0x10u
+#define EDMA3_PARAM_LINK    0x14u
+#define EDMA3_PARAM_CIDX    0x18u
+#define EDMA3_PARAM_CCNT    0x1Cu
+
+#define EDMA3_OPT_STATIC    (1u << 3)
+#define EDMA3_OPT_TCC(tcc)  ((tcc) << 12)
+#define EDMA3_OPT_TCINTEN   (1u << 20)
+
+/*  Trigger word of the QDMA channels: CCNT, the last word written */
+#define EDMA3_TRWORD_CCNT   7u
+
+/*  Largest ACNT of a single A-synchronised transfer */
+#define EDMA3_MAX_ACNT      0xFFFFu
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_copyGlobal
+ *
+ *  @desc   Converts a local L1/L2 address of the DSP to the global address
+ *          seen by the EDMA3.
+ *
+ *  @arg    addr
+ *              CPU address.
+ *
+ *  @ret    Global address.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_EDMA3_GLOBAL_OFFSET
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 RING_IO_copyGlobal(const Void * addr);
+#endif /* if defined (RING_IO_EDMA3) */
+
+#if defined (RING_IO_LOCAL)
+/** ============================================================================
+ *  @name   RING_IO_CopyWorker
+ *
+ *  @desc   Worker thread of an engine in the host build. The copy in flight
+ *          and RING_IO_copyBusy of the engine are guarded by lock.
+ *
+ *  @field  thread
+ *              Worker thread.
+ *  @field  lock
+ *              Guards the fields below and RING_IO_copyBusy of the engine.
+ *  @field  start
+ *              Signalled when a copy is submitted.
+ *  @field  done
+ *              Signalled when the copy completes.
+ *  @field  dst, src, size
+ *              Copy in flight.
+ *  ============================================================================
+ */
+typedef struct RING_IO_CopyWorker_tag {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	Void * dst;
+	const Void * src;
+	Uint32 size;
+} RING_IO_CopyWorker;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_copyWorkerMain
+ *
+ *  @desc   Worker thread of an engine: runs each submitted copy with memcpy
+ *          and marks the engine idle.
+ *
+ *  @arg    arg
+ *              RING_IO_CopyWorker of the engine.
+ *
+ *  @ret    NULL, never reached.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_copySubmit
+ *  ----------------------------------------------------------------------------
+ */
+static Void * RING_IO_copyWorkerMain(Void * arg);
+
+/** ============================================================================
+ *  @name   RING_IO_copyWorkers
+ *
+ *  @desc   Worker of each engine, started once by RING_IO_copyInit.
+ *  ============================================================================
+ */
+static RING_IO_CopyWorker RING_IO_copyWorkers[RING_IO_COPY_ENGINES];
+
+/** ============================================================================
+ *  @name   RING_IO_copyStarted
+ *
+ *  @desc   TRUE once the workers are running.
+ *  ============================================================================
+ */
+static Bool RING_IO_copyStarted = FALSE;
+#endif /* if defined (RING_IO_LOCAL) */
+
+/** ============================================================================
+ *  @name   RING_IO_copyBusy
+ *
+ *  @desc   TRUE while an engine has a copy in flight.
+ *  ============================================================================
+ */
+static volatile Bool RING_IO_copyBusy[RING_IO_COPY_ENGINES];
+
+#if defined (_TMS320C6X)
+/** ============================================================================
+ *  @name   RING_IO_prefetchSink
+ *
+ *  @desc   Keeps the loads of RING_IO_prefetch from being optimised away.
+ *  ============================================================================
+ */
+static volatile Uint32 RING_IO_prefetchSink;
+#endif /* if defined (_TMS320C6X) */
+
+
+/*  ============================================================================
+ *  Hot path placement, see ring_io_hot.cmd of the platform.
+ *  ============================================================================
+ */
+#if defined (_TMS320C6X)
+#pragma CODE_SECTION (RING_IO_copySubmit, ".text:ringio_hot")
+#pragma CODE_SECTION (RING_IO_copyPoll, ".text:ringio_hot")
+#pragma CODE_SECTION (RING_IO_copyWait, ".text:ringio_hot")
+#pragma CODE_SECTION (RING_IO_prefetch, ".text:ringio_hot")
+#endif /* if defined (_TMS320C6X) */
+
+/** ============================================================================
+ *  @func   RING_IO_copyInit
+ *
+ *  @desc   Sets up the copy engines.
+ *
+ *  @modif  RING_IO_copyBusy
+ *  ============================================================================
+ */
+Int RING_IO_copyInit(Void) {
+	Int status = SYS_OK;
+	Uint32 engine;
+
+	for (engine = 0; engine < RING_IO_COPY_ENGINES; engine++) {
+		RING_IO_copyBusy[engine] = FALSE;
+#if defined (RING_IO_LOCAL)
+		if ((RING_IO_copyStarted == FALSE) && (status == SYS_OK)) {
+			pthread_mutex_init(&RING_IO_copyWorkers[engine].lock, NULL);
+			pthread_cond_init(&RING_IO_copyWorkers[engine].start, NULL);
+			pthread_cond_init(&RING_IO_copyWorkers[engine].done, NULL);
+			if (pthread_create(&RING_IO_copyWorkers[engine].thread, NULL,
+					&RING_IO_copyWorkerMain,
+					&RING_IO_copyWorkers[engine]) != 0) {
+				status = SYS_EALLOC;
+			}
+		}
+#endif /* if defined (RING_IO_LOCAL) */
+#if defined (RING_IO_EDMA3)
+		EDMA3_REG(EDMA3_QCHMAP(RING_IO_EDMA3_QCHAN + engine)) =
+				((RING_IO_EDMA3_PARAM + engine) << 5)
+				| (EDMA3_TRWORD_CCNT << 2);
+		EDMA3_REG(EDMA3_ICR) = (1u << (RING_IO_EDMA3_TCC + engine));
+		EDMA3_REG(EDMA3_QEESR) = (1u << (RING_IO_EDMA3_QCHAN + engine));
+#endif /* if defined (RING_IO_EDMA3) */
+	}
+#if defined (RING_IO_LOCAL)
+	/* Without its workers every engine copies with the CPU */
+	RING_IO_copyStarted = (status == SYS_OK);
+#endif /* if defined (RING_IO_LOCAL) */
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_copySubmit
+ *
+ *  @desc   Starts a copy on an engine.
+ *
+ *  @modif  RING_IO_copyBusy
+ *  ============================================================================
+ */
+Int RING_IO_copySubmit(Uint32 engine, Void * dst, const Void * src,
+		Uint32 size) {
+	Int status = SYS_OK;
+#if defined (RING_IO_EDMA3)
+	Uint32 param;
+	Uint32 tcc;
+#endif /* if defined (RING_IO_EDMA3) */
+
+	if (engine >= RING_IO_COPY_ENGINES) {
+		status = SYS_EINVAL;
+	} else {
+		RING_IO_copyWait(engine);
+
+#if defined (RING_IO_EDMA3)
+		if ((size != 0) && (size <= EDMA3_MAX_ACNT)) {
+			/* The EDMA3 does not see the cache: write the source back and
+			 * drop the destination lines, which the CPU must not touch until
+			 * the copy completes.
+			 */
+			BCACHE_wb((Ptr) src, size, FALSE);
+			BCACHE_wbInv(dst, size, TRUE);
+
+			param = EDMA3_PARAM(RING_IO_EDMA3_PARAM + engine);
+			tcc = RING_IO_EDMA3_TCC + engine;
+			EDMA3_REG(param + EDMA3_PARAM_OPT) = EDMA3_OPT_STATIC
+					| EDMA3_OPT_TCC(tcc) | EDMA3_OPT_TCINTEN;
+			EDMA3_REG(param + EDMA3_PARAM_SRC) = RING_IO_copyGlobal(src);
+			EDMA3_REG(param + EDMA3_PARAM_ABCNT) = (1u << 16) | size;
+			EDMA3_REG(param + EDMA3_PARAM_DST) = RING_IO_copyGlobal(dst);
+			EDMA3_REG(param + EDMA3_PARAM_BIDX) = 0;
+			EDMA3_REG(param + EDMA3_PARAM_LINK) = 0xFFFFu;
+			EDMA3_REG(param + EDMA3_PARAM_CIDX) = 0;
+
+			RING_IO_copyBusy[engine] = TRUE;
+			/* Writing the trigger word starts the transfer */
+			EDMA3_REG(param + EDMA3_PARAM_CCNT) = 1u;
+		} else
+#endif /* if defined (RING_IO_EDMA3) */
+#if defined (RING_IO_LOCAL)
+		if ((RING_IO_copyStarted == TRUE) && (size != 0)) {
+			pthread_mutex_lock(&RING_IO_copyWorkers[engine].lock);
+			RING_IO_copyWorkers[engine].dst = dst;
+			RING_IO_copyWorkers[engine].src = src;
+			RING_IO_copyWorkers[engine].size = size;
+			RING_IO_copyBusy[engine] = TRUE;
+			pthread_cond_signal(&RING_IO_copyWorkers[engine].start);
+			pthread_mutex_unlock(&RING_IO_copyWorkers[engine].lock);
+		} else
+#endif /* if defined (RING_IO_LOCAL) */
+		{
+			/* No engine for it: the CPU copies now */
+			memcpy(dst, src, size);
+		}
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_copyPoll
+ *
+ *  @desc   Checks whether the last copy of an engine has completed.
+ *
+ *  @modif  RING_IO_copyBusy
+ *  ============================================================================
+ */
+Bool RING_IO_copyPoll(Uint32 engine) {
+#if defined (RING_IO_LOCAL)
+	Bool busy;
+
+	pthread_mutex_lock(&RING_IO_copyWorkers[engine].lock);
+	busy = RING_IO_copyBusy[engine];
+	pthread_mutex_unlock(&RING_IO_copyWorkers[engine].lock);
+
+	return (!busy);
+#else /* if defined (RING_IO_LOCAL) */
+#if defined (RING_IO_EDMA3)
+	Uint32 mask = 1u << (RING_IO_EDMA3_TCC + engine);
+
+	if ((RING_IO_copyBusy[engine])
+			&& ((EDMA3_REG(EDMA3_IPR) & mask) != 0)) {
+		EDMA3_REG(EDMA3_ICR) = mask;
+		RING_IO_copyBusy[engine] = FALSE;
+	}
+#endif /* if defined (RING_IO_EDMA3) */
+
+	return (!RING_IO_copyBusy[engine]);
+#endif /* if defined (RING_IO_LOCAL) */
+}
+
+/** ============================================================================
+ *  @func   RING_IO_copyWait
+ *
+ *  @desc   Waits for the last copy of an engine to complete.
+ *
+ *  @modif  RING_IO_copyBusy
+ *  ============================================================================
+ */
+Void RING_IO_copyWait(Uint32 engine) {
+#if defined (RING_IO_LOCAL)
+	pthread_mutex_lock(&RING_IO_copyWorkers[engine].lock);
+	while (RING_IO_copyBusy[engine]) {
+		pthread_cond_wait(&RING_IO_copyWorkers[engine].done,
+				&RING_IO_copyWorkers[engine].lock);
+	}
+	pthread_mutex_unlock(&RING_IO_copyWorkers[engine].lock);
+#else /* if defined (RING_IO_LOCAL) */
+	while (!RING_IO_copyPoll(engine)) {
+		/* Transfers are at most EDMA3_MAX_ACNT bytes, spin */
+	}
+#endif /* if defined (RING_IO_LOCAL) */
+}
+
+/** ============================================================================
+ *  @func   RING_IO_prefetch
+ *
+ *  @desc   Starts bringing a buffer into the data cache.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Void RING_IO_prefetch(const Void * addr, Uint32 size) {
+	const Uint8 * line = (const Uint8 *) addr;
+	const Uint8 * end = line + size;
+#if defined (_TMS320C6X)
+	Uint32 sum = 0;
+
+	if (size != 0) {
+		for (; line < end; line += RING_IO_PREFETCH_LINE) {
+			sum += *line;
+		}
+		/* The last line when the buffer is not line aligned */
+		sum += *(end - 1);
+		RING_IO_prefetchSink = sum;
+	}
+#elif defined (__GNUC__)
+	for (; line < end; line += RING_IO_PREFETCH_LINE) {
+		__builtin_prefetch(line, 0, 3);
+	}
+	if (size != 0) {
+		__builtin_prefetch(end - 1, 0, 3);
+	}
+#else
+	(Void) line;
+	(Void) end;
+#endif /* if defined (_TMS320C6X) */
+}
+
+#if defined (RING_IO_EDMA3)
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_copyGlobal
+ *
+ *  @desc   Converts a local L1/L2 address to a global address.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 RING_IO_copyGlobal(const Void * addr) {
+	Uint32 global = (Uint32) addr;
+
+	if (global < 0x01000000u) {
+		global += RING_IO_EDMA3_GLOBAL_OFFSET;
+	}
+
+	return (global);
+}
+#endif /* if defined (RING_IO_EDMA3) */
+
+#if defined (RING_IO_LOCAL)
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_copyWorkerMain
+ *
+ *  @desc   Worker thread of an engine.
+ *
+ *  @modif  RING_IO_copyBusy
+ *  ----------------------------------------------------------------------------
+ */
+static Void * RING_IO_copyWorkerMain(Void * arg) {
+	RING_IO_CopyWorker * worker = (RING_IO_CopyWorker *) arg;
+	Uint32 engine = (Uint32) (worker - RING_IO_copyWorkers);
+
+	pthread_mutex_lock(&worker->lock);
+	for (;;) {
+		while (!RING_IO_copyBusy[engine]) {
+			pthread_cond_wait(&worker->start, &worker->lock);
+		}
+		/* The submitter waits for the engine before touching the copy */
+		pthread_mutex_unlock(&worker->lock);
+		memcpy(worker->dst, worker->src, worker->size);
+		pthread_mutex_lock(&worker->lock);
+		RING_IO_copyBusy[engine] = FALSE;
+		pthread_cond_broadcast(&worker->done);
+	}
+
+	return (NULL);
+}
+#endif /* if defined (RING_IO_LOCAL) */
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,234 @@
+/** ============================================================================
+ *  @file   ring_io_copy.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Asynchronous copy engine of the RING_IO sample. With RING_IO_EDMA3
+ *          defined, copies run on EDMA3 QDMA channels; otherwise the CPU
+ *          copies at submit time and nothing overlaps the copy.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_COPY_)
+#define RING_IO_COPY_
+
+/*  --------------------------- DSP/BIOS Headers ----------------------------- */
+#if defined (RING_IO_LOCAL)
+#include <ring_io_local.h>
+#else /* if defined (RING_IO_LOCAL) */
+#include <std.h>
+#endif /* if defined (RING_IO_LOCAL) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_COPY_ENGINES
+ *
+ *  @desc   Number of copy engines, one per RingIO channel. Each engine has
+ *          at most one copy in flight.
+ *  ============================================================================
+ */
+#define RING_IO_COPY_ENGINES    2u
+
+/** ============================================================================
+ *  @const  RING_IO_COPY_OVERLAP
+ *
+ *  @desc   TRUE when copies run in the background between RING_IO_copySubmit
+ *          and their completion, so that the caller can work meanwhile.
+ *  ============================================================================
+ */
+#if defined (RING_IO_EDMA3) || defined (RING_IO_LOCAL)
+#define RING_IO_COPY_OVERLAP    TRUE
+#else
+#define RING_IO_COPY_OVERLAP    FALSE
+#endif /* if defined (RING_IO_EDMA3) || defined (RING_IO_LOCAL) */
+
+/** ============================================================================
+ *  @const  RING_IO_COPY_LINE
+ *
+ *  @desc   Cache line size in bytes of the copy destinations. The submit
+ *          writes back and invalidates the lines of the destination, so
+ *          while a copy is in flight the CPU must not touch the line
+ *          holding the start of the destination, even outside of it.
+ *  ============================================================================
+ */
+#define RING_IO_COPY_LINE       128u
+
+/** ============================================================================
+ *  @const  RING_IO_PREFETCH_LINE
+ *
+ *  @desc   Stride of RING_IO_prefetch in bytes, the L1D line size of the
+ *          C64x+.
+ *  ============================================================================
+ */
+#define RING_IO_PREFETCH_LINE   64u
+
+/** ============================================================================
+ *  @func   RING_IO_copyInit
+ *
+ *  @desc   Sets up the copy engines. With RING_IO_EDMA3, maps each engine's
+ *          QDMA channel to its PaRAM set and enables the channel. In the
+ *          host build (RING_IO_LOCAL), starts one worker thread per engine
+ *          that runs the copies with memcpy.
+ *
+ *  @arg    None
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          SYS_EALLOC
+ *              A worker thread could not be started (host build).
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_copySubmit
+ *  ============================================================================
+ */
+Int RING_IO_copyInit (Void) ;
+
+/** ============================================================================
+ *  @func   RING_IO_copySubmit
+ *
+ *  @desc   Starts copying size bytes from src to dst on an engine, waiting
+ *          first for the engine's previous copy. dst and the rest of its
+ *          first cache line (RING_IO_COPY_LINE) must not be accessed until
+ *          RING_IO_copyPoll or RING_IO_copyWait report completion. Without
+ *          RING_IO_COPY_OVERLAP the copy is done before the return.
+ *
+ *  @arg    engine
+ *              Copy engine, less than RING_IO_COPY_ENGINES.
+ *  @arg    dst
+ *              Destination buffer.
+ *  @arg    src
+ *              Source buffer.
+ *  @arg    size
+ *              Number of bytes to copy.
+ *
+ *  @ret    SYS_OK
+ *              Copy started.
+ *          SYS_EINVAL
+ *              Invalid engine.
+ *
+ *  @enter  RING_IO_copyInit has been called.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_copyPoll, RING_IO_copyWait
+ *  ============================================================================
+ */
+Int RING_IO_copySubmit (Uint32       engine,
+                        Void *       dst,
+                        const Void * src,
+                        Uint32       size) ;
+
+/** ============================================================================
+ *  @func   RING_IO_copyPoll
+ *
+ *  @desc   Checks whether the last copy of an engine has completed.
+ *
+ *  @arg    engine
+ *              Copy engine.
+ *
+ *  @ret    TRUE
+ *              No copy in flight.
+ *          FALSE
+ *              The copy is still running.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_copySubmit
+ *  ============================================================================
+ */
+Bool RING_IO_copyPoll (Uint32 engine) ;
+
+/** ============================================================================
+ *  @func   RING_IO_copyWait
+ *
+ *  @desc   Waits for the last copy of an engine to complete.
+ *
+ *  @arg    engine
+ *              Copy engine.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  No copy in flight on the engine.
+ *
+ *  @see    RING_IO_copySubmit
+ *  ============================================================================
+ */
+Void RING_IO_copyWait (Uint32 engine) ;
+
+/** ============================================================================
+ *  @func   RING_IO_prefetch
+ *
+ *  @desc   Starts bringing a buffer into the data cache. GCC builds use
+ *          __builtin_prefetch, which does not wait for the data. The C6000
+ *          has no prefetch instruction: one load per L1D line is issued
+ *          with nothing depending on it, so the L1D pipelines the misses
+ *          and the whole buffer costs little more than one miss.
+ *
+ *  @arg    addr
+ *              Start of the buffer.
+ *  @arg    size
+ *              Size of the buffer in bytes.
+ *
+ *  @ret    None
+ *
+ *  @enter  The buffer is valid for reading; on cached shared memory its
+ *          coherence operations have been done.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_PREFETCH_LINE
+ *  ============================================================================
+ */
+Void RING_IO_prefetch (const Void * addr, Uint32 size) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+#endif /* !defined (RING_IO_COPY_) */
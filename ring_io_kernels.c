@@ -0,0 +1,319 @@
+/** ============================================================================
+ *  @file   ring_io_kernels.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Generic processing kernels of the RING_IO sample.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+/* ---------------------------- DSP/BIOS Headers ---------------------------- */
+#include <std.h>
+#include <sys.h>
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <string.h>
+
+/*  --------------------------- RingIO Headers ----------------------------- */
+#include <ringio.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_config.h>
+#include <ring_io_kernels.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  Hot path placement, see ring_io_hot.cmd of the platform.
+ *  ============================================================================
+ */
+#if defined (_TMS320C6X)
+#pragma CODE_SECTION (RING_IO_apply, ".text:ringio_hot")
+#pragma CODE_SECTION (RING_IO_scaleShift, ".text:ringio_hot")
+#pragma CODE_SECTION (RING_IO_copySwap, ".text:ringio_hot")
+#pragma CODE_SECTION (RING_IO_hash, ".text:ringio_hot")
+#if (DSP_MAUSIZE == 1)
+#pragma CODE_SECTION (RING_IO_scaleLookup, ".text:ringio_hot")
+#endif /* if (DSP_MAUSIZE == 1) */
+#endif /* if defined (_TMS320C6X) */
+
+/** ============================================================================
+ *  @func   RING_IO_apply
+ *
+ *  @desc   This function multiples or divides the data in the buffer by a value
+ *          specified in the factor variable.(inplace processing)
+ *  @field buffer
+ *       data buffer that needs to be processed.
+ *  @field factor
+ *        scale value
+ *  @field opCode
+ *         specifies the operation to be performed
+ *       (OP_MULTIPLY/OP_DIVIDE)
+ *  @field size
+ *        size of the buffer that needs to be processed.
+ *
+ *  @modif  buffer
+ *  ============================================================================
+ */
+Void RING_IO_apply(RingIO_BufPtr * buffer, Uint32 factor, Uint32 opCode,
+		Uint32 size) {
+	RING_IO_View view;
+	Uint32 i;
+
+	if (buffer != NULL) {
+		RING_IO_VIEW_INIT(&view, buffer, size, RING_IO_Mau, 0, 1u);
+
+		switch (opCode) {
+		case OP_MULTIPLY:
+			for (i = 0; i < view.count; i++) {
+				RING_IO_VIEW_AT(&view, RING_IO_Mau, i) = (RING_IO_Mau)
+						RING_IO_OP_MUL(RING_IO_VIEW_AT(&view, RING_IO_Mau, i),
+								factor);
+			}
+			break;
+
+		case OP_DIVIDE:
+			for (i = 0; i < view.count; i++) {
+				RING_IO_VIEW_AT(&view, RING_IO_Mau, i) = (RING_IO_Mau)
+						RING_IO_OP_DIV(RING_IO_VIEW_AT(&view, RING_IO_Mau, i),
+								factor);
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+/** ============================================================================
+ *  @func   RING_IO_scaleShift
+ *
+ *  @desc   Scales a buffer in place by a power of two.
+ *
+ *  @modif  buffer
+ *  ============================================================================
+ */
+Void RING_IO_scaleShift(RING_IO_Mau * buffer, Uint32 count, Uint32 opCode,
+		Uint32 shift) {
+	Uint32 i = 0;
+#if (DSP_MAUSIZE == 1)
+	Uint32 * word = (Uint32 *) buffer;
+	Uint32 words = count >> 2;
+	Uint32 mask;
+
+	/* Four samples per word, masking off the bits shifted across samples */
+	if (opCode == OP_MULTIPLY) {
+		mask = ((0xFFu << shift) & 0xFFu) * 0x01010101u;
+		for (i = 0; i < words; i++) {
+			word[i] = (word[i] << shift) & mask;
+		}
+	} else {
+		mask = (0xFFu >> shift) * 0x01010101u;
+		for (i = 0; i < words; i++) {
+			word[i] = (word[i] >> shift) & mask;
+		}
+	}
+	i = words << 2;
+#endif /* if (DSP_MAUSIZE == 1) */
+
+	for (; i < count; i++) {
+		if (opCode == OP_MULTIPLY) {
+			buffer[i] = (RING_IO_Mau) ((Uint32) buffer[i] << shift);
+		} else {
+			buffer[i] = (RING_IO_Mau) ((Uint32) buffer[i] >> shift);
+		}
+	}
+}
+
+/** ============================================================================
+ *  @func   RING_IO_scaleLog2
+ *
+ *  @desc   Rounds a scale factor to the nearest power of two.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Uint32 RING_IO_scaleLog2(Uint32 factor) {
+	Uint32 width = 8u * DSP_MAUSIZE;
+	Uint32 shift = 0;
+
+	if (factor == 0) {
+		shift = width;
+	} else {
+		while ((factor >> shift) > 1u) {
+			shift++;
+		}
+		/* Round up from halfway to the next power of two */
+		if ((shift != 0) && (((factor >> (shift - 1u)) & 1u) != 0)) {
+			shift++;
+		}
+		if (shift > width) {
+			shift = width;
+		}
+	}
+
+	return (shift);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_copySwap
+ *
+ *  @desc   Copies a chunk of input data into the frame buffer, converting
+ *          the byte order of the samples.
+ *
+ *  @modif  frame
+ *  ============================================================================
+ */
+Void RING_IO_copySwap(Char * frame, Uint32 offset, const Char * src,
+		Uint32 size, Uint32 limit, Uint32 format) {
+	Uint8 * dst = (Uint8 *) frame;
+	const Uint8 * in = (const Uint8 *) src;
+	Uint32 mask;
+	Uint32 idx;
+	Uint32 i = 0;
+#if defined (_TMS320C6X)
+	Uint32 words;
+	Uint32 x;
+#endif /* if defined (_TMS320C6X) */
+
+	if (format == RING_IO_FMT_NATIVE) {
+		memcpy((frame + offset), src, size);
+	} else {
+		mask = (format == RING_IO_FMT_BE16) ? 1u : 3u;
+
+#if defined (_TMS320C6X)
+		if ((offset & 3u) == 0) {
+			/* Whole words, the frame buffer is word aligned */
+			words = size >> 2;
+			if (mask == 1u) {
+				for (i = 0; i < words; i++) {
+					x = _mem4((Void *) (in + (i << 2)));
+					_amem4(dst + offset + (i << 2)) = _swap4(x);
+				}
+			} else {
+				for (i = 0; i < words; i++) {
+					x = _swap4(_mem4((Void *) (in + (i << 2))));
+					_amem4(dst + offset + (i << 2)) = _packlh2(x, x);
+				}
+			}
+			i = words << 2;
+		}
+#endif /* if defined (_TMS320C6X) */
+
+		/* Bytes of samples split over chunks, and the portable path */
+		for (; i < size; i++) {
+			idx = (offset + i) ^ mask;
+			if (idx < limit) {
+				dst[idx] = in[i];
+			}
+		}
+	}
+}
+
+#if (DSP_MAUSIZE == 1)
+/** ============================================================================
+ *  @func   RING_IO_scaleTableBuild
+ *
+ *  @desc   Fills in a scale lookup table.
+ *
+ *  @modif  table
+ *  ============================================================================
+ */
+Int RING_IO_scaleTableBuild(Void * table, Uint32 size, Uint32 opCode,
+		Uint32 factor) {
+	Int status = SYS_OK;
+	Uint8 * entry = (Uint8 *) table;
+	Uint32 i;
+
+	if ((size != RING_IO_SCALE_TABLESIZE)
+			|| ((opCode != OP_MULTIPLY) && (opCode != OP_DIVIDE))
+			|| ((opCode == OP_DIVIDE) && (factor == 0))) {
+		status = SYS_EINVAL;
+	} else {
+		for (i = 0; i < RING_IO_SCALE_TABLESIZE; i++) {
+			entry[i] = (Uint8) i;
+		}
+		RING_IO_apply((RingIO_BufPtr *) entry, factor, opCode,
+				RING_IO_SCALE_TABLESIZE);
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_scaleLookup
+ *
+ *  @desc   Scales a buffer in place through a lookup table.
+ *
+ *  @modif  buffer
+ *  ============================================================================
+ */
+Void RING_IO_scaleLookup(RING_IO_Mau * buffer, Uint32 count,
+		const Uint8 * table) {
+	Uint32 i;
+
+	for (i = 0; i < count; i++) {
+		buffer[i] = table[buffer[i]];
+	}
+}
+#endif /* if (DSP_MAUSIZE == 1) */
+
+/** ============================================================================
+ *  @func   RING_IO_hash
+ *
+ *  @desc   Continues a 32-bit FNV-1a hash over a buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Uint32 RING_IO_hash(Uint32 hash, const Void * data, Uint32 size) {
+	const Uint8 * byte = (const Uint8 *) data;
+	Uint32 i;
+
+	for (i = 0; i < size; i++) {
+		hash = (hash ^ byte[i]) * 16777619u;
+	}
+
+	return (hash);
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
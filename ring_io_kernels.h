@@ -0,0 +1,409 @@
+/** ============================================================================
+ *  @file   ring_io_kernels.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Processing kernels used by the stages of the RING_IO sample.
+ *          Generic kernels take their parameters at run time. Specialised
+ *          kernels are generated by RING_IO_DEFINE_SCALE_KERNEL with their
+ *          operation and factor fixed at compile time.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_KERNELS_)
+#define RING_IO_KERNELS_
+
+/*  --------------------------- DSP/BIOS Headers ----------------------------- */
+#include <std.h>
+
+/*  --------------------------- RingIO Headers ----------------------------- */
+#include <ringio.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_config.h>
+#include <ring_io_view.h>
+#include <ring_io_protocol.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @name   OP_FACTOR
+ *
+ *  @desc   The value used by dsp to perform mulification and division on
+ *          received data.
+ *  ============================================================================
+ */
+#define OP_FACTOR            2u
+
+/*  ============================================================================
+ *  @name   OP_MULTIPLY
+ *
+ *  @desc   Macro to indicates multiplication  needs to be performed on the
+ *          received data with OP_FACTOR by DSP.
+ *
+ *  ============================================================================
+ */
+#define OP_MULTIPLY         1u
+
+/*  ============================================================================
+ *  @name   OP_DIVIDE
+ *
+ *  @desc   Macro to indicates division  needs to be performed on the
+ *          received data with OP_FACTOR by DSP.
+ *  ============================================================================
+ */
+#define OP_DIVIDE           2u
+
+/** ============================================================================
+ *  @name   RING_IO_Mau
+ *
+ *  @desc   Type of one minimum addressable unit of the DSP.
+ *  ============================================================================
+ */
+#if (DSP_MAUSIZE == 1)
+typedef Uint8  RING_IO_Mau ;
+#else
+typedef Uint16 RING_IO_Mau ;
+#endif /* if (DSP_MAUSIZE == 1) */
+
+/** ============================================================================
+ *  @name   RING_IO_OP_MUL, RING_IO_OP_DIV
+ *
+ *  @desc   Element operations used to instantiate the scale kernels.
+ *  ============================================================================
+ */
+#define RING_IO_OP_MUL(x, factor)   ((x) * (factor))
+#define RING_IO_OP_DIV(x, factor)   ((x) / (factor))
+
+/** ============================================================================
+ *  @func   RING_IO_viewCopy
+ *
+ *  @desc   Copies the addressable units of one view into another.
+ *  ============================================================================
+ */
+RING_IO_DEFINE_VIEW_COPY (RING_IO_viewCopy, RING_IO_Mau)
+
+/** ============================================================================
+ *  @name   RING_IO_DEFINE_SCALE_KERNEL
+ *
+ *  @desc   Defines an inline scale kernel with its operation and factor fixed
+ *          at compile time. When the kernel is called with a constant count
+ *          the compiler sees a loop with a constant trip count and no
+ *          branches, which it can fully software pipeline.
+ *
+ *  @arg    name
+ *              Name of the kernel function.
+ *  @arg    op
+ *              RING_IO_OP_MUL or RING_IO_OP_DIV.
+ *  @arg    factor
+ *              Scale factor.
+ *  ============================================================================
+ */
+#define RING_IO_DEFINE_SCALE_KERNEL(name, op, factor)                          \
+static inline Void name (RING_IO_Mau * restrict buffer, Uint32 count)         \
+{                                                                              \
+    Uint32 i ;                                                                 \
+                                                                               \
+    for (i = 0 ; i < count ; i++) {                                            \
+        buffer [i] = (RING_IO_Mau) op (buffer [i], (factor)) ;                 \
+    }                                                                          \
+}
+
+/** ============================================================================
+ *  @func   RING_IO_scaleMulFactor, RING_IO_scaleDivFactor
+ *
+ *  @desc   Scale kernels specialised for OP_FACTOR.
+ *  ============================================================================
+ */
+RING_IO_DEFINE_SCALE_KERNEL (RING_IO_scaleMulFactor, RING_IO_OP_MUL, OP_FACTOR)
+RING_IO_DEFINE_SCALE_KERNEL (RING_IO_scaleDivFactor, RING_IO_OP_DIV, OP_FACTOR)
+
+#if defined (RING_IO_FIXED_CONFIG)
+/** ============================================================================
+ *  @func   RING_IO_scaleFixed
+ *
+ *  @desc   Scale kernel specialised for the single configuration build.
+ *  ============================================================================
+ */
+#if (RING_IO_FIXED_OPCODE == OP_MULTIPLY)
+RING_IO_DEFINE_SCALE_KERNEL (RING_IO_scaleFixed,
+                             RING_IO_OP_MUL,
+                             RING_IO_FIXED_FACTOR)
+#else
+RING_IO_DEFINE_SCALE_KERNEL (RING_IO_scaleFixed,
+                             RING_IO_OP_DIV,
+                             RING_IO_FIXED_FACTOR)
+#endif /* if (RING_IO_FIXED_OPCODE == OP_MULTIPLY) */
+
+#if ((RING_IO_FIXED_FRAMESIZE % RING_IO_STAGE_BLOCKSIZE) != 0)
+#error RING_IO_FIXED_FRAMESIZE must be a multiple of RING_IO_STAGE_BLOCKSIZE
+#endif
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+
+/** ============================================================================
+ *  @func   RING_IO_copySwap
+ *
+ *  @desc   Copies a chunk of input data into the frame buffer, converting
+ *          the samples to the byte order of the DSP on the way. Each byte is
+ *          placed by its offset in the frame, so a sample split over two
+ *          chunks still ends up in order. Aligned chunks are converted a
+ *          word at a time with _swap4/_packlh2 on C6000.
+ *
+ *  @arg    frame
+ *              Frame buffer.
+ *  @arg    offset
+ *              Offset of the chunk in the frame, in bytes.
+ *  @arg    src
+ *              Input chunk.
+ *  @arg    size
+ *              Size of the input chunk in bytes.
+ *  @arg    limit
+ *              Size of the frame buffer in bytes.
+ *  @arg    format
+ *              RING_IO_FMT_NATIVE, RING_IO_FMT_BE16 or RING_IO_FMT_BE32.
+ *
+ *  @ret    None
+ *
+ *  @enter  offset + size is not more than limit.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+Void RING_IO_copySwap (Char *       frame,
+                       Uint32       offset,
+                       const Char * src,
+                       Uint32       size,
+                       Uint32       limit,
+                       Uint32       format) ;
+
+#if (DSP_MAUSIZE == 1)
+/** ============================================================================
+ *  @const  RING_IO_SCALE_TABLESIZE
+ *
+ *  @desc   Size in bytes of a scale lookup table, one entry per sample
+ *          value.
+ *  ============================================================================
+ */
+#define RING_IO_SCALE_TABLESIZE  256u
+
+/** ============================================================================
+ *  @func   RING_IO_scaleTableBuild
+ *
+ *  @desc   RING_IO_TableBuild function of the RING_IO_TABLE_SCALE tables:
+ *          fills in the result of RING_IO_apply for every sample value.
+ *
+ *  @arg    table
+ *              Table of RING_IO_SCALE_TABLESIZE bytes.
+ *  @arg    size
+ *              Size of the table.
+ *  @arg    opCode
+ *              OP_MULTIPLY or OP_DIVIDE.
+ *  @arg    factor
+ *              Scale value.
+ *
+ *  @ret    SYS_OK
+ *              Table built.
+ *          SYS_EINVAL
+ *              Wrong size, unknown operation or division by zero.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_tableGet
+ *  ============================================================================
+ */
+Int RING_IO_scaleTableBuild (Void * table,
+                             Uint32 size,
+                             Uint32 opCode,
+                             Uint32 factor) ;
+
+/** ============================================================================
+ *  @func   RING_IO_scaleLookup
+ *
+ *  @desc   Scales a buffer in place through a table built by
+ *          RING_IO_scaleTableBuild, which avoids the division of the C6000
+ *          run-time library for OP_DIVIDE.
+ *
+ *  @arg    buffer
+ *              Samples, processed in place.
+ *  @arg    count
+ *              Number of samples.
+ *  @arg    table
+ *              Scale lookup table.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_apply
+ *  ============================================================================
+ */
+Void RING_IO_scaleLookup (RING_IO_Mau * buffer,
+                          Uint32        count,
+                          const Uint8 * table) ;
+#endif /* if (DSP_MAUSIZE == 1) */
+
+/** ============================================================================
+ *  @const  RING_IO_HASH_INIT
+ *
+ *  @desc   Initial value of RING_IO_hash.
+ *  ============================================================================
+ */
+#define RING_IO_HASH_INIT      2166136261u
+
+/** ============================================================================
+ *  @func   RING_IO_hash
+ *
+ *  @desc   Continues a 32-bit FNV-1a hash over a buffer, so a frame
+ *          received in several chunks can be hashed one chunk at a time.
+ *
+ *  @arg    hash
+ *              Hash of the preceding data, RING_IO_HASH_INIT to start.
+ *  @arg    data
+ *              Buffer to hash.
+ *  @arg    size
+ *              Size of the buffer in bytes.
+ *
+ *  @ret    <hash>
+ *              Hash of the preceding data and the buffer.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+Uint32 RING_IO_hash (Uint32 hash, const Void * data, Uint32 size) ;
+
+
+/** ============================================================================
+ *  @func   RING_IO_apply
+ *
+ *  @desc   This function multiples or divides the data in the buffer by a value
+ *          specified in the factor variable.(inplace processing)
+ *
+ *  @arg    buffer
+ *              Data buffer that needs to be processed.
+ *  @arg    factor
+ *              Scale value.
+ *  @arg    opCode
+ *              Specifies the operation to be performed (OP_MULTIPLY/OP_DIVIDE).
+ *  @arg    size
+ *              Size of the buffer that needs to be processed.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_DEFINE_SCALE_KERNEL
+ *  ============================================================================
+ */
+Void RING_IO_apply (RingIO_BufPtr * buffer,
+                    Uint32          factor,
+                    Uint32          opCode,
+                    Uint32          size) ;
+
+/** ============================================================================
+ *  @func   RING_IO_scaleShift
+ *
+ *  @desc   Cheap approximation of RING_IO_apply that scales by a power of
+ *          two, the factor rounded by RING_IO_scaleLog2. Samples are shifted
+ *          four to a word when the MAU is a byte. Exact when the factor is a
+ *          power of two.
+ *
+ *  @arg    buffer
+ *              Samples, processed in place.
+ *  @arg    count
+ *              Number of samples.
+ *  @arg    opCode
+ *              OP_MULTIPLY or OP_DIVIDE.
+ *  @arg    shift
+ *              Shift from RING_IO_scaleLog2.
+ *
+ *  @ret    None
+ *
+ *  @enter  buffer is word aligned.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_apply
+ *  ============================================================================
+ */
+Void RING_IO_scaleShift (RING_IO_Mau * buffer,
+                         Uint32        count,
+                         Uint32        opCode,
+                         Uint32        shift) ;
+
+/** ============================================================================
+ *  @func   RING_IO_scaleLog2
+ *
+ *  @desc   Rounds a scale factor to the nearest power of two, for
+ *          RING_IO_scaleShift. A factor of 0 and factors beyond the sample
+ *          width give the full sample width, so multiplying clears the
+ *          samples.
+ *
+ *  @arg    factor
+ *              Scale value.
+ *
+ *  @ret    <shift>
+ *              Base 2 logarithm of the rounded factor.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_scaleShift
+ *  ============================================================================
+ */
+Uint32 RING_IO_scaleLog2 (Uint32 factor) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+#endif /* !defined (RING_IO_KERNELS_) */
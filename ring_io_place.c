@@ -0,0 +1,120 @@
+/** ============================================================================
+ *  @file   ring_io_place.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Placement of the channels on the DSPs, see ring_io_place.h.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+/* ---------------------------- DSP/BIOS Headers ----------------------------- */
+#if defined (RING_IO_LOCAL)
+/* Host build of the placement test, see gpp/ring_io_place_test.c */
+#include <ring_io_local.h>
+#else /* if defined (RING_IO_LOCAL) */
+#include <std.h>
+#include <sys.h>
+#endif /* if defined (RING_IO_LOCAL) */
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <string.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_protocol.h>
+#include <ring_io_place.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @func   RING_IO_placeServes
+ *
+ *  @desc   Tells whether a DSP serves a channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Bool RING_IO_placeServes(Uint32 place, Uint32 procId) {
+	return ((place == RING_IO_PLACE_LOCAL) || (place == RING_IO_PLACE_EACH)
+			|| (place == procId));
+}
+
+/** ============================================================================
+ *  @func   RING_IO_placeName
+ *
+ *  @desc   Builds the name of a RingIO of a channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+Int RING_IO_placeName(Char * name, const Char * base, Uint32 place,
+		Uint32 procId) {
+	Int status = SYS_OK;
+	Char digits[10];
+	Uint32 len;
+	Uint32 numDigits = 0;
+
+	len = strlen(base);
+	if (place != RING_IO_PLACE_LOCAL) {
+		/* Decimal digits of the processor ID, lowest first */
+		do {
+			digits[numDigits++] = (Char) ('0' + (procId % 10u));
+			procId /= 10u;
+		} while (procId != 0u);
+	}
+
+	if ((len + 1u + numDigits) >= RING_IO_NAME_LEN) {
+		status = SYS_EINVAL;
+	} else {
+		memcpy(name, base, len);
+		if (numDigits != 0u) {
+			name[len++] = RING_IO_NAME_SEP;
+			while (numDigits != 0u) {
+				name[len++] = digits[--numDigits];
+			}
+		}
+		name[len] = '\0';
+	}
+
+	return (status);
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,153 @@
+/** ============================================================================
+ *  @file   ring_io_place.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Placement of the channels on the DSPs. Each channel is served by
+ *          the DSP running the image, by every DSP, or by one DSP given by its
+ *          processor ID, so that one image serves its share of the channels
+ *          on any DSP of the system.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_PLACE_)
+#define RING_IO_PLACE_
+
+/*  --------------------------- DSP/BIOS Headers ----------------------------- */
+#if defined (RING_IO_LOCAL)
+#include <ring_io_local.h>
+#else /* if defined (RING_IO_LOCAL) */
+#include <std.h>
+#endif /* if defined (RING_IO_LOCAL) */
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_PLACE_LOCAL
+ *
+ *  @desc   Placement of a channel served by whichever DSP runs the image,
+ *          under the plain RingIO names. This is the single DSP setup.
+ *  ============================================================================
+ */
+#define RING_IO_PLACE_LOCAL     0xFFFFu
+
+/** ============================================================================
+ *  @const  RING_IO_PLACE_EACH
+ *
+ *  @desc   Placement of a channel served by every DSP, each under its own
+ *          RingIO names.
+ *          Any other placement is the processor ID of the one DSP serving
+ *          the channel.
+ *  ============================================================================
+ */
+#define RING_IO_PLACE_EACH      0xFFFEu
+
+/** ============================================================================
+ *  @const  RING_IO_NAME_LEN
+ *
+ *  @desc   Size of the buffer holding a RingIO name, terminator included.
+ *  ============================================================================
+ */
+#define RING_IO_NAME_LEN        32u
+
+
+/** ============================================================================
+ *  @func   RING_IO_placeServes
+ *
+ *  @desc   Tells whether a DSP serves a channel.
+ *
+ *  @arg    place
+ *              Placement of the channel.
+ *  @arg    procId
+ *              Processor ID of the DSP.
+ *
+ *  @ret    TRUE
+ *              The DSP serves the channel.
+ *          FALSE
+ *              Another DSP does.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_placeName
+ *  ============================================================================
+ */
+Bool RING_IO_placeServes(Uint32 place, Uint32 procId);
+
+/** ============================================================================
+ *  @func   RING_IO_placeName
+ *
+ *  @desc   Builds the name of a RingIO of a channel. A channel placed other
+ *          than RING_IO_PLACE_LOCAL has per processor names: the base name
+ *          followed by RING_IO_NAME_SEP and the processor ID in decimal,
+ *          e.g. "RINGIO1_2". A local channel keeps the base name.
+ *
+ *  @arg    name
+ *              Buffer of RING_IO_NAME_LEN characters receiving the name.
+ *  @arg    base
+ *              Base name of the RingIO.
+ *  @arg    place
+ *              Placement of the channel.
+ *  @arg    procId
+ *              Processor ID of the DSP serving the channel.
+ *
+ *  @ret    SYS_OK
+ *              The name has been built.
+ *          SYS_EINVAL
+ *              The name does not fit.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_placeServes
+ *  ============================================================================
+ */
+Int RING_IO_placeName(Char * name, const Char * base, Uint32 place,
+		Uint32 procId);
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (RING_IO_PLACE_) */
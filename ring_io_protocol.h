@@ -0,0 +1,235 @@
+/** ============================================================================
+ *  @file   ring_io_protocol.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Frame protocol spoken on the RingIO channels between the GPP and
+ *          the DSP: fixed attribute types, notification messages and the
+ *          sample formats. It has no DSP/BIOS dependencies so that the GPP
+ *          client library can share it.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_PROTOCOL_)
+#define RING_IO_PROTOCOL_
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_START
+ *
+ *  @desc    Fixed attribute type indicates  start of the data in the RingIO
+ *  ============================================================================
+ */
+#define RINGIO_DATA_START       1u
+
+/*  ============================================================================
+ *  @const   NOTIFY_DATA_START
+ *
+ *  @desc    Message id to send data start notification  to  DSP.
+ *  ============================================================================
+ */
+#define NOTIFY_DATA_START       2u
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_END
+ *
+ *  @desc    Fixed attribute type indicates  start of the data in the RingIO
+ *  ============================================================================
+ */
+#define RINGIO_DATA_END         3u
+
+/*  ============================================================================
+ *  @const   NOTIFY_DATA_END
+ *
+ *  @desc    Message id to send data start notification  to  DSP.
+ *  ============================================================================
+ */
+#define NOTIFY_DATA_END         4u
+
+
+
+/*  ============================================================================
+ *  @const   RINGIO_DSP_END
+ *
+ *  @desc     Fixed attribute type indicates  end of the dsp 
+ *  ============================================================================
+ */
+#define RINGIO_DSP_END         5u
+
+
+/*  ============================================================================
+ *  @const   NOTIFY_DSP_END
+ *
+ *  @desc     Notification message  to  DSP.Indicates DSP end
+ *  ============================================================================
+ */
+#define NOTIFY_DSP_END         6u
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_SHED
+ *
+ *  @desc    Fixed attribute type marking a frame dropped by the load
+ *           shedding policy. The parameter carries the dropped byte count.
+ *  ============================================================================
+ */
+#define RINGIO_DATA_SHED       7u
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_PASS
+ *
+ *  @desc    Fixed attribute type marking a frame forwarded without running
+ *           the processing stages. The parameter carries the frame size.
+ *  ============================================================================
+ */
+#define RINGIO_DATA_PASS       8u
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_FORMAT
+ *
+ *  @desc    Fixed attribute type from the GPP selecting the byte order of
+ *           the input samples, sent after RINGIO_DATA_START. The parameter
+ *           carries RING_IO_FMT_NATIVE, RING_IO_FMT_BE16 or RING_IO_FMT_BE32.
+ *           It stays in effect for the following frames.
+ *  ============================================================================
+ */
+#define RINGIO_DATA_FORMAT     9u
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_REPEAT
+ *
+ *  @desc    Fixed attribute type sent in place of a frame whose output is the
+ *           same as the previous frame's. The parameter carries the frame
+ *           size.
+ *  ============================================================================
+ */
+#define RINGIO_DATA_REPEAT     10u
+
+/*  ============================================================================
+ *  @const   NOTIFY_DSP_SELFTEST
+ *
+ *  @desc    Message id asking a DSP channel to run its loopback
+ *           self-benchmark between frames. The results are reported in the
+ *           channel statistics.
+ *  ============================================================================
+ */
+#define NOTIFY_DSP_SELFTEST    11u
+
+/*  ============================================================================
+ *  @const   RINGIO_DATA_PACKED
+ *
+ *  @desc    Variable attribute type of a packed record: several attributes
+ *           taken at one offset in a single call. The payload is a list of
+ *           word pairs, a key followed by its value. A key is a fixed
+ *           attribute type, with the parameter as value, or
+ *           RING_IO_PACK_SIZE. A record holds at most RING_IO_PACK_MAX pairs.
+ *           A RINGIO_DATA_END key next to a non-zero RING_IO_PACK_SIZE ends
+ *           the frame after the chunk, so the last chunk of a frame carries
+ *           its end.
+ *  ============================================================================
+ */
+#define RINGIO_DATA_PACKED     12u
+
+/** ============================================================================
+ *  @const  RING_IO_NAME_SEP
+ *
+ *  @desc   Separator between the base name of a RingIO and the processor ID
+ *          of the DSP serving it, for channels with per processor names
+ *          (see ring_io_place.h on the DSP), e.g. "RINGIO1_2".
+ *  ============================================================================
+ */
+#define RING_IO_NAME_SEP       '_'
+
+/** ============================================================================
+ *  @name   RING_IO_VATTR_SIZE
+ *
+ *  @desc   Word of the variable attribute payload carrying the size in bytes
+ *          of the data chunk following the attribute (attrs[0]). Both sides
+ *          attach it ahead of each chunk they write.
+ *  ============================================================================
+ */
+#define RING_IO_VATTR_SIZE     0u
+
+/** ============================================================================
+ *  @const  RING_IO_PACK_SIZE
+ *
+ *  @desc   Key of a packed record (RINGIO_DATA_PACKED) carrying the size in
+ *          bytes of the data chunk following the record, in place of the
+ *          RING_IO_VATTR_SIZE word of an unpacked size attribute.
+ *  ============================================================================
+ */
+#define RING_IO_PACK_SIZE      0u
+
+/** ============================================================================
+ *  @const  RING_IO_PACK_MAX, RING_IO_PACK_WORDS
+ *
+ *  @desc   Largest number of key/value pairs in a packed record, and the
+ *          size of its payload in words.
+ *  ============================================================================
+ */
+#define RING_IO_PACK_MAX       4u
+#define RING_IO_PACK_WORDS     (2u * RING_IO_PACK_MAX)
+
+/** ============================================================================
+ *  @const  RING_IO_PACK_BIT
+ *
+ *  @desc   Bit of a key in the set of keys found in a packed record.
+ *  ============================================================================
+ */
+#define RING_IO_PACK_BIT(key)  (1u << (key))
+
+/** ============================================================================
+ *  @name   RING_IO_FMT_NATIVE, RING_IO_FMT_BE16, RING_IO_FMT_BE32
+ *
+ *  @desc   Sample formats of the input stream, selected by the
+ *          RINGIO_DATA_FORMAT attribute, see RING_IO_copySwap on the DSP.
+ *  ============================================================================
+ */
+#define RING_IO_FMT_NATIVE  0u
+#define RING_IO_FMT_BE16    1u
+#define RING_IO_FMT_BE32    2u
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (RING_IO_PROTOCOL_) */
@@ -0,0 +1,322 @@
+/** ============================================================================
+ *  @file   ring_io_tables.c
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Keyed, reference counted cache of precomputed tables shared by
+ *          the RING_IO channels.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+/* ---------------------------- DSP/BIOS Headers ---------------------------- */
+#include <std.h>
+#include <sys.h>
+#include <mem.h>
+#include <tsk.h>
+
+/*  --------------------------- DSP/BIOS LINK Headers ----------------------- */
+#include <dsplink.h>
+#include <failure.h>
+
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_config.h>
+#include <ring_io_tables.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  FILEID
+ *
+ *  @desc   FILEID is used by SET_FAILURE_REASON macro.
+ *  ============================================================================
+ */
+#define FILEID  FID_APP_C
+
+/** ============================================================================
+ *  @name   RING_IO_TableEntry
+ *
+ *  @desc   One cached table.
+ *
+ *  @field  kind
+ *              Table kind, 0 for a free entry.
+ *  @field  param0
+ *              First key parameter.
+ *  @field  param1
+ *              Second key parameter.
+ *  @field  size
+ *              Size of the table in bytes.
+ *  @field  refCount
+ *              Number of users holding the table, including the task
+ *              building it.
+ *  @field  building
+ *              TRUE while a task builds the table outside of the lock. The
+ *              other users of the key wait for it.
+ *  @field  lastUse
+ *              Value of RING_IO_tableClock when the table was last put back,
+ *              to free the oldest unused table first.
+ *  @field  table
+ *              The table.
+ *  ============================================================================
+ */
+typedef struct RING_IO_TableEntry_tag {
+    Uint32         kind ;
+    Uint32         param0 ;
+    Uint32         param1 ;
+    Uint32         size ;
+    Uint32         refCount ;
+    Bool           building ;
+    Uint32         lastUse ;
+    Void *         table ;
+} RING_IO_TableEntry ;
+
+/** ============================================================================
+ *  @name   RING_IO_tables
+ *
+ *  @desc   The table cache.
+ *  ============================================================================
+ */
+static RING_IO_TableEntry RING_IO_tables[RING_IO_TABLE_ENTRIES];
+
+/** ============================================================================
+ *  @name   RING_IO_tableClock
+ *
+ *  @desc   Counts the puts, orders the unused tables by age.
+ *  ============================================================================
+ */
+static Uint32 RING_IO_tableClock;
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_tableSlot
+ *
+ *  @desc   Finds an entry for a new table: a free one, else the unused table
+ *          put back longest ago, which is dropped from the cache. The caller
+ *          frees the dropped table once task switching is enabled again.
+ *
+ *  @arg    oldTable
+ *              Location to receive the dropped table, left alone if a free
+ *              entry was found.
+ *  @arg    oldSize
+ *              Location to receive the size of the dropped table.
+ *
+ *  @ret    <entry>
+ *              Free entry.
+ *          NULL
+ *              All tables are in use.
+ *
+ *  @enter  Task switching is disabled.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_tableGet
+ *  ----------------------------------------------------------------------------
+ */
+static RING_IO_TableEntry * RING_IO_tableSlot(Void ** oldTable,
+		Uint32 * oldSize);
+
+
+/** ============================================================================
+ *  @func   RING_IO_tableGet
+ *
+ *  @desc   Returns the table of a key, building it on first use.
+ *
+ *  @modif  RING_IO_tables
+ *  ============================================================================
+ */
+Int RING_IO_tableGet(Uint32 kind, Uint32 param0, Uint32 param1, Uint32 size,
+		RING_IO_TableBuild build, const Void ** table) {
+	Int status = SYS_OK;
+	RING_IO_TableEntry * entry;
+	Void * oldTable;
+	Uint32 oldSize = 0;
+	Void * newTable = NULL;
+	Bool done = FALSE;
+	Uint32 i;
+
+	*table = NULL;
+
+	while (done == FALSE) {
+		entry = NULL;
+		oldTable = NULL;
+
+		/* Only the lookup and the reference counts run with task switching
+		 * disabled; the allocation and the build run outside.
+		 */
+		TSK_disable();
+		for (i = 0; (i < RING_IO_TABLE_ENTRIES) && (entry == NULL); i++) {
+			if ((RING_IO_tables[i].kind == kind)
+					&& (RING_IO_tables[i].param0 == param0)
+					&& (RING_IO_tables[i].param1 == param1)
+					&& (RING_IO_tables[i].size == size)) {
+				entry = &RING_IO_tables[i];
+			}
+		}
+
+		if (entry == NULL) {
+			entry = RING_IO_tableSlot(&oldTable, &oldSize);
+			if (entry == NULL) {
+				status = SYS_EALLOC;
+				SET_FAILURE_REASON(status);
+			} else {
+				/* Claim the entry, the reference keeps it from being
+				 * reused while it is built
+				 */
+				entry->kind = kind;
+				entry->param0 = param0;
+				entry->param1 = param1;
+				entry->size = size;
+				entry->refCount = 1u;
+				entry->building = TRUE;
+				entry->table = NULL;
+			}
+			done = TRUE;
+		} else if (entry->building == FALSE) {
+			entry->refCount++;
+			*table = entry->table;
+			entry = NULL;
+			done = TRUE;
+		}
+		TSK_enable();
+
+		if (oldTable != NULL) {
+			MEM_free(RING_IO_TABLE_SEGID, oldTable, oldSize);
+		}
+
+		if (done == FALSE) {
+			/* Another task is building the table, look again once it ran */
+			TSK_sleep(1);
+		}
+	}
+
+	if ((status == SYS_OK) && (entry != NULL)) {
+		newTable = MEM_calloc(RING_IO_TABLE_SEGID, size, DSPLINK_BUF_ALIGN);
+		if (newTable == NULL) {
+			status = SYS_EALLOC;
+			SET_FAILURE_REASON(status);
+		} else {
+			status = (*build)(newTable, size, param0, param1);
+			if (status != SYS_OK) {
+				MEM_free(RING_IO_TABLE_SEGID, newTable, size);
+				newTable = NULL;
+				SET_FAILURE_REASON(status);
+			}
+		}
+
+		TSK_disable();
+		if (status == SYS_OK) {
+			entry->table = newTable;
+		} else {
+			/* Tasks waiting for the key build it themselves */
+			entry->kind = 0;
+			entry->refCount = 0;
+		}
+		entry->building = FALSE;
+		TSK_enable();
+
+		*table = newTable;
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   RING_IO_tablePut
+ *
+ *  @desc   Drops a reference taken by RING_IO_tableGet. The table stays
+ *          cached.
+ *
+ *  @modif  RING_IO_tables
+ *  ============================================================================
+ */
+Int RING_IO_tablePut(const Void * table) {
+	Int status = SYS_ENOTFOUND;
+	Uint32 i;
+
+	TSK_disable();
+	for (i = 0; i < RING_IO_TABLE_ENTRIES; i++) {
+		if ((RING_IO_tables[i].kind != 0) && (table != NULL)
+				&& (RING_IO_tables[i].table == table)
+				&& (RING_IO_tables[i].refCount != 0)) {
+			RING_IO_tables[i].refCount--;
+			RING_IO_tables[i].lastUse = ++RING_IO_tableClock;
+			status = SYS_OK;
+			break;
+		}
+	}
+	TSK_enable();
+
+	return (status);
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   RING_IO_tableSlot
+ *
+ *  @desc   Finds an entry for a new table.
+ *
+ *  @modif  RING_IO_tables
+ *  ----------------------------------------------------------------------------
+ */
+static RING_IO_TableEntry * RING_IO_tableSlot(Void ** oldTable,
+		Uint32 * oldSize) {
+	RING_IO_TableEntry * entry = NULL;
+	Bool free = FALSE;
+	Uint32 i;
+
+	for (i = 0; (i < RING_IO_TABLE_ENTRIES) && (free == FALSE); i++) {
+		if (RING_IO_tables[i].kind == 0) {
+			entry = &RING_IO_tables[i];
+			free = TRUE;
+		} else if ((RING_IO_tables[i].refCount == 0) && ((entry == NULL)
+				|| (RING_IO_tables[i].lastUse < entry->lastUse))) {
+			entry = &RING_IO_tables[i];
+		}
+	}
+
+	if ((entry != NULL) && (free == FALSE)) {
+		*oldTable = entry->table;
+		*oldSize = entry->size;
+		entry->table = NULL;
+		entry->kind = 0;
+	}
+
+	return (entry);
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
@@ -0,0 +1,172 @@
+/** ============================================================================
+ *  @file   ring_io_tables.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Keyed, reference counted cache of precomputed tables shared by
+ *          the RING_IO channels.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_TABLES_)
+#define RING_IO_TABLES_
+
+/*  --------------------------- DSP/BIOS Headers ----------------------------- */
+#include <std.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @const  RING_IO_TABLE_ENTRIES
+ *
+ *  @desc   Number of distinct tables the cache holds at a time.
+ *  ============================================================================
+ */
+#define RING_IO_TABLE_ENTRIES   8u
+
+/** ============================================================================
+ *  @name   RING_IO_TABLE_SCALE
+ *
+ *  @desc   Table kinds. Each kind defines the meaning of the two key
+ *          parameters of its tables.
+ *          RING_IO_TABLE_SCALE: scale lookup table, parameters are the
+ *          operation (OP_MULTIPLY/OP_DIVIDE) and the factor.
+ *  ============================================================================
+ */
+#define RING_IO_TABLE_SCALE     1u
+
+/** ============================================================================
+ *  @name   RING_IO_TableBuild
+ *
+ *  @desc   Function filling in a table of the cache.
+ *
+ *  @arg    table
+ *              Table to fill in, of the size given to RING_IO_tableGet.
+ *  @arg    size
+ *              Size of the table in bytes.
+ *  @arg    param0
+ *              First key parameter.
+ *  @arg    param1
+ *              Second key parameter.
+ *
+ *  @ret    SYS_OK
+ *              Table built.
+ *          Other
+ *              Failure, the table is not cached.
+ *  ============================================================================
+ */
+typedef Int (*RING_IO_TableBuild) (Void * table,
+                                   Uint32 size,
+                                   Uint32 param0,
+                                   Uint32 param1) ;
+
+/** ============================================================================
+ *  @func   RING_IO_tableGet
+ *
+ *  @desc   Returns the table of a key, building it on first use. Callers
+ *          asking for the same key share one read-only copy, allocated from
+ *          RING_IO_TABLE_SEGID. A table stays cached after its last user
+ *          puts it back, so a restarted channel finds it again; it is freed
+ *          only to make room for another key. The allocation and the build
+ *          run with task switching enabled; a task asking for a key that
+ *          another task is building sleeps until the build is done.
+ *
+ *  @arg    kind
+ *              Table kind, e.g. RING_IO_TABLE_SCALE.
+ *  @arg    param0
+ *              First key parameter.
+ *  @arg    param1
+ *              Second key parameter.
+ *  @arg    size
+ *              Size of the table in bytes.
+ *  @arg    build
+ *              Function filling in the table when it is not cached.
+ *  @arg    table
+ *              Location to receive the table.
+ *
+ *  @ret    SYS_OK
+ *              Operation successful.
+ *          SYS_EALLOC
+ *              No free cache entry or memory for the table.
+ *          Other
+ *              Status of the build function.
+ *
+ *  @enter  Called from main() or task context.
+ *
+ *  @leave  On success the caller holds a reference to the table.
+ *
+ *  @see    RING_IO_tablePut
+ *  ============================================================================
+ */
+Int RING_IO_tableGet (Uint32             kind,
+                      Uint32             param0,
+                      Uint32             param1,
+                      Uint32             size,
+                      RING_IO_TableBuild build,
+                      const Void **      table) ;
+
+/** ============================================================================
+ *  @func   RING_IO_tablePut
+ *
+ *  @desc   Drops a reference taken by RING_IO_tableGet.
+ *
+ *  @arg    table
+ *              Table returned by RING_IO_tableGet.
+ *
+ *  @ret    SYS_OK
+ *              Operation successful.
+ *          SYS_ENOTFOUND
+ *              The table is not in the cache.
+ *
+ *  @enter  Called from main() or task context.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_tableGet
+ *  ============================================================================
+ */
+Int RING_IO_tablePut (const Void * table) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+#endif /* !defined (RING_IO_TABLES_) */
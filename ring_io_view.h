@@ -0,0 +1,177 @@
+/** ============================================================================
+ *  @file   ring_io_view.h
+ *
+ *  @path   $(DSPLINK)/dsp/src/samples/ring_io/
+ *
+ *  @desc   Typed views over the sample buffers of the RING_IO sample. A view
+ *          gives the element type, count and channel stride of a span, and
+ *          converts RingIO byte sizes to elements at compile time for any
+ *          DSP_MAUSIZE.
+ *
+ *  @ver    1.65.00.02
+ *  ============================================================================
+ *  Copyright (C) 2002-2009, Texas Instruments Incorporated -
+ *  http://www.ti.com/
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  
+ *  *  Neither the name of Texas Instruments Incorporated nor the names of
+ *     its contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *  
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *  ============================================================================
+ */
+
+
+#if !defined (RING_IO_VIEW_)
+#define RING_IO_VIEW_
+
+/*  --------------------------- DSP/BIOS Headers ----------------------------- */
+#include <std.h>
+
+
+#if defined (__cplusplus)
+extern "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   RING_IO_MAUS, RING_IO_BYTES
+ *
+ *  @desc   Conversions between RingIO sizes, which are in bytes, and
+ *          addressable units of the DSP.
+ *  ============================================================================
+ */
+#define RING_IO_MAUS(bytes)     ((bytes) / DSP_MAUSIZE)
+#define RING_IO_BYTES(maus)     ((maus) * DSP_MAUSIZE)
+
+/** ============================================================================
+ *  @name   RING_IO_ELEM_BYTES
+ *
+ *  @desc   Size in bytes of one element of a type.
+ *  ============================================================================
+ */
+#define RING_IO_ELEM_BYTES(type)    (sizeof (type) * DSP_MAUSIZE)
+
+/** ============================================================================
+ *  @name   RING_IO_View
+ *
+ *  @desc   View of the samples of one channel in a buffer. The element
+ *          type is not stored; it is given to RING_IO_VIEW_INIT and
+ *          RING_IO_VIEW_AT, so the accesses compile to plain typed loads
+ *          and stores.
+ *
+ *  @field  base
+ *              First element of the view.
+ *  @field  count
+ *              Number of elements in the view.
+ *  @field  stride
+ *              Distance between consecutive elements, in elements: 1 for a
+ *              single channel, the channel count for one channel of an
+ *              interleaved stream.
+ *  ============================================================================
+ */
+typedef struct RING_IO_View_tag {
+    Void *         base ;
+    Uint32         count ;
+    Uint32         stride ;
+} RING_IO_View ;
+
+/** ============================================================================
+ *  @name   RING_IO_VIEW_INIT
+ *
+ *  @desc   Sets up a view of one channel of a buffer holding bytes of
+ *          interleaved elements of a type.
+ *
+ *  @arg    view
+ *              View to set up.
+ *  @arg    buffer
+ *              Buffer, e.g. an acquired RingIO span.
+ *  @arg    bytes
+ *              Size of the buffer in bytes.
+ *  @arg    type
+ *              Element type.
+ *  @arg    channel
+ *              Channel of the view, less than channels.
+ *  @arg    channels
+ *              Number of interleaved channels, 1 for a plain stream.
+ *  ============================================================================
+ */
+#define RING_IO_VIEW_INIT(view, buffer, bytes, type, channel, channels)        \
+do {                                                                           \
+    Uint32 _elems = (Uint32) ((bytes) / RING_IO_ELEM_BYTES (type)) ;           \
+                                                                               \
+    (view)->base   = (Void *) (((type *) (buffer)) + (channel)) ;             \
+    (view)->stride = (channels) ;                                              \
+    (view)->count  = (_elems > (channel)) ?                                    \
+                     ((_elems - (channel) + (channels) - 1u) / (channels)) :   \
+                     0 ;                                                       \
+} while (0)
+
+/** ============================================================================
+ *  @name   RING_IO_VIEW_AT
+ *
+ *  @desc   Element i of a view, as an lvalue of the element type.
+ *
+ *  @arg    view
+ *              View.
+ *  @arg    type
+ *              Element type the view was set up with.
+ *  @arg    i
+ *              Index of the element, less than the view count.
+ *  ============================================================================
+ */
+#define RING_IO_VIEW_AT(view, type, i)                                         \
+        (((type *) (view)->base) [(i) * (view)->stride])
+
+/** ============================================================================
+ *  @name   RING_IO_DEFINE_VIEW_COPY
+ *
+ *  @desc   Defines an inline function copying the elements of one view into
+ *          another, as many as the shorter view holds.
+ *
+ *  @arg    name
+ *              Name of the function.
+ *  @arg    type
+ *              Element type of both views.
+ *  ============================================================================
+ */
+#define RING_IO_DEFINE_VIEW_COPY(name, type)                                   \
+static inline Uint32 name (const RING_IO_View * dst, const RING_IO_View * src) \
+{                                                                              \
+    Uint32 count = (dst->count < src->count) ? dst->count : src->count ;       \
+    Uint32 i ;                                                                 \
+                                                                               \
+    for (i = 0 ; i < count ; i++) {                                            \
+        RING_IO_VIEW_AT (dst, type, i) = RING_IO_VIEW_AT (src, type, i) ;      \
+    }                                                                          \
+                                                                               \
+    return count ;                                                             \
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+#endif /* !defined (RING_IO_VIEW_) */
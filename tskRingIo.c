@@ -60,6 +60,11 @@
 #include <tsk.h>
 #include <pool.h>
 #include <gbl.h>
+#include <clk.h>
+#include <bcache.h>
+
+/*  --------------------------- RTS Headers ----------------------------- */
+#include <string.h>
 
 /*  --------------------------- DSP/BIOS LINK Headers ----------------------- */
 #include <failure.h>
@@ -74,6 +79,11 @@
 #endif
 /*  --------------------------- Sample Headers ---------------------------- */
 #include <ring_io_config.h>
+#include <ring_io_protocol.h>
+#include <ring_io_kernels.h>
+#include <ring_io_copy.h>
+#include <ring_io_tables.h>
+#include <ring_io_place.h>
 #include <tskRingIo.h>
 
 /** ============================================================================
@@ -84,34 +94,6 @@
  */
 #define FILEID  FID_APP_C
 
-/*  ============================================================================
- *  @name   OP_FACTOR
- *
- *  @desc   The value used by dsp to perform mulification and division on
- *          received data.
- *  ============================================================================
- */
-#define OP_FACTOR            2u
-
-/*  ============================================================================
- *  @name   OP_MULTIPLY
- *
- *  @desc   Macro to indicates multiplication  needs to be performed on the
- *          received data with OP_FACTOR by DSP.
- *
- *  ============================================================================
- */
-#define OP_MULTIPLY         1u
-
-/*  ============================================================================
- *  @name   OP_DIVIDE
- *
- *  @desc   Macro to indicates division  needs to be performed on the
- *          received data with OP_FACTOR by DSP.
- *  ============================================================================
- */
-#define OP_DIVIDE           2u
-
 /** ============================================================================
  *  @const  RINGIO_WRITE_ACQ_SIZE
  *
@@ -128,61 +110,6 @@
  */
 #define RINGIO_READ_ACQ_SIZE     512u
 
-/*  ============================================================================
- *  @const   RINGIO_DATA_START
- *
- *  @desc    Fixed attribute type indicates  start of the data in the RingIO
- *  ============================================================================
- */
-#define RINGIO_DATA_START       1u
-
-/*  ============================================================================
- *  @const   NOTIFY_DATA_START
- *
- *  @desc    Message id to send data start notification  to  DSP.
- *  ============================================================================
- */
-#define NOTIFY_DATA_START       2u
-
-/*  ============================================================================
- *  @const   RINGIO_DATA_END
- *
- *  @desc    Fixed attribute type indicates  start of the data in the RingIO
- *  ============================================================================
- */
-#define RINGIO_DATA_END         3u
-
-/*  ============================================================================
- *  @const   NOTIFY_DATA_END
- *
- *  @desc    Message id to send data start notification  to  DSP.
- *  ============================================================================
- */
-#define NOTIFY_DATA_END         4u
-
-
-
-/*  ============================================================================
- *  @const   RINGIO_DSP_END
- *
- *  @desc     Fixed attribute type indicates  end of the dsp 
- *  ============================================================================
- */
-#define RINGIO_DSP_END         5u
-
-
-/*  ============================================================================
- *  @const   NOTIFY_DSP_END
- *
- *  @desc     Notification message  to  DSP.Indicates DSP end
- *  ============================================================================
- */
-#define NOTIFY_DSP_END         6u
-
-
-
-
-
 /** ============================================================================
  *  @name   RING_IO_xferBufSize
  *
@@ -243,6 +170,33 @@ extern Uint16 RING_IO_footBufSize;
  */
 Uint32 attrs[MAX_VATTR_NUM];
 
+/** ============================================================================
+ *  @const  NUM_CHANNELS
+ *
+ *  @desc   Number of RingIO channels of the application.
+ *  ============================================================================
+ */
+#define NUM_CHANNELS        2u
+
+/** ============================================================================
+ *  @const  TSKRING_IO_SCALE_ACTIVE
+ *
+ *  @desc   TRUE when the channel has a scale operation to apply. Without one
+ *          the frame goes out as received.
+ *  ============================================================================
+ */
+#define TSKRING_IO_SCALE_ACTIVE(info)                                          \
+        (((info)->scaleOpCode == OP_MULTIPLY)                                  \
+         || (((info)->scaleOpCode == OP_DIVIDE) && ((info)->scalingFactor != 0)))
+
+/** ============================================================================
+ *  @name   TSKRING_IO_channels
+ *
+ *  @desc   Created channels, for the PRD driven notification timer.
+ *  ============================================================================
+ */
+static TSKRING_IO_TransferInfo * TSKRING_IO_channels[NUM_CHANNELS];
+
 /** ----------------------------------------------------------------------------
  *  @func   TSKRING_IO_writer_notify
  *
@@ -296,145 +250,1112 @@ TSKRING_IO_reader_notify(RingIO_Handle handle, RingIO_NotifyParam param,
 		RingIO_NotifyMsg msg);
 
 /** ----------------------------------------------------------------------------
- *  @func   RING_IO_apply
+ *  @func   TSKRING_IO_shedCheck
  *
- *  @desc   This function multiples or divides the data in the buffer by a value
- *          specified in the factor variable.(inplace processing)
- *  @field buffer
- *       data buffer that needs to be processed.
- *  @field factor
- *        scale value
- *  @field opCode
- *         specifies the operation to be performed
- *       (OP_MULTIPLY/OP_DIVIDE)
- *  @field size
- *        size of the buffer that needs to be processed.
+ *  @desc   Runs the overload detector at the start of a frame and applies the
+ *          channel load shedding policy to the frame.
  *
- *  @modif  buffer
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_frameDone
  *  ----------------------------------------------------------------------------
  */
-static Void
-		RING_IO_apply(RingIO_BufPtr * buffer, Uint32 factor, Uint32 opCode,
-				Uint32 size);
+static Void TSKRING_IO_shedCheck(TSKRING_IO_TransferInfo * info);
 
-#if defined (DSP_BOOTMODE_NOBOOT)
-/** ============================================================================
- *  @name   smaPoolObj
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_markFrame
  *
- *  @desc   Global object for pool parameters for the dynamic POOL_open call
- *  ============================================================================
+ *  @desc   Sets the shed/pass-through attribute on the output RingIO for a
+ *          frame selected by the load shedding policy.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    size
+ *              Number of bytes received for the frame.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Attribute set, or none was needed.
+ *          RINGIO_EFAILURE
+ *              Failure while setting the attribute.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_shedCheck
+ *  ----------------------------------------------------------------------------
  */
-SMAPOOL_Params smaPoolObj;
-#endif
-/** ============================================================================
- *  @func   TSKRING_IO_create
+static Int TSKRING_IO_markFrame(TSKRING_IO_TransferInfo * info, Uint32 size);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_frameDone
  *
- *  @desc   Create phase function for the RING_IO application. Initializes the
- *          TSKRING_IO_TransferInfo structure with the information that will be
- *          used by the other phases of the application.
+ *  @desc   Updates the channel counters and the deadline miss run at the end
+ *          of a frame.
  *
- *  @modif  None.
- *  ============================================================================
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_shedCheck
+ *  ----------------------------------------------------------------------------
  */
-Int TSKRING_IO_create1(TSKRING_IO_TransferInfo ** infoPtr) {
-	Int status = SYS_OK;
-	TSKRING_IO_TransferInfo * info = NULL;
-	RingIO_Attrs ringIoAttrs;
-	Uint32 flags;
-	RingIO_Handle writerHandle;
-	RingIO_Handle readerHandle;
+static Void TSKRING_IO_frameDone(TSKRING_IO_TransferInfo * info);
 
-	/*
-	 *  Create the RingIO to be used with DSP as the writer.
-	 */
-	if (status == SYS_OK) {
-		ringIoAttrs.transportType = RINGIO_TRANSPORT_GPP_DSP;
-		ringIoAttrs.ctrlPoolId = SAMPLE_POOL_ID;
-		ringIoAttrs.dataPoolId = SAMPLE_POOL_ID;
-		ringIoAttrs.attrPoolId = SAMPLE_POOL_ID;
-		ringIoAttrs.lockPoolId = SAMPLE_POOL_ID;
-		ringIoAttrs.dataBufSize = RING_IO_dataBufSize1;
-		ringIoAttrs.footBufSize = RING_IO_footBufSize;
-		ringIoAttrs.attrBufSize = RING_IO_attrBufSize;
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_degradeCheck
+ *
+ *  @desc   Switches the channel between the full and fallback stage variants
+ *          at a frame boundary, based on stage load and input RingIO fill.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  TSKRING_IO_shedCheck has sampled the fill level for the frame.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_runStages
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_degradeCheck(TSKRING_IO_TransferInfo * info);
 
-#if defined (DSPLINK_LEGACY_SUPPORT)
-		status = RingIO_create (RING_IO_WRITER_NAME1, &ringIoAttrs);
-#else
-		status = RingIO_create(GBL_getProcId(), RING_IO_WRITER_NAME1,
-				&ringIoAttrs);
-#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
-		if (status != SYS_OK) {
-			SET_FAILURE_REASON(status);
-		}
-	}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_jitterWait
+ *
+ *  @desc   Jitter buffer. Delays consumption of the frame that has just
+ *          started on the input RingIO until its release slot, so that frames
+ *          leave the channel at a steady cadence. The frame stays in the
+ *          RingIO while it is held; nothing is copied.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    stamp
+ *              GPP timestamp of the frame in microseconds, carried as the
+ *              parameter of the RINGIO_DATA_START attribute. 0 if the GPP
+ *              does not timestamp its frames.
+ *
+ *  @ret    None
+ *
+ *  @enter  The RINGIO_DATA_START attribute of the frame has been read.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_jitterWait(TSKRING_IO_TransferInfo * info, Uint32 stamp);
 
-	/*
-	 *  Open the RingIO to be used with DSP as the writer.
-	 */
-	if (status == SYS_OK) {
-		/* Value of the flags indicates:
-		 *     Cache coherence required for: Control structure
-		 *                                   Data buffer
-		 *                                   Attribute buffer
-		 *     Exact size requirement.
-		 */
-		flags = RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
-				| RINGIO_CONTROL_CACHEUSE | RINGIO_NEED_EXACT_SIZE;
-		do {
-			writerHandle = RingIO_open(RING_IO_WRITER_NAME1, RINGIO_MODE_WRITE,
-					flags);
-			if (writerHandle == NULL) {
-				status = RINGIO_EFAILURE;
-				SET_FAILURE_REASON(status);
-			}
-		} while (writerHandle == NULL);
-	}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_usToHtime
+ *
+ *  @desc   Converts microseconds to CLK_gethtime() counts.
+ *
+ *  @arg    usec
+ *              Time in microseconds.
+ *
+ *  @ret    <counts>
+ *              Equivalent number of CLK_gethtime() counts.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_usToHtime(Uint32 usec);
 
-	/*
-	 *  Open the RingIO to be used with DSP as the reader.
-	 */
-	if (status == SYS_OK) {
-		/* Wait till the RingIO is created by the GPP. */
-		do {
-			/* Value of the flags indicates:
-			 *     Cache coherence required for: Control structure
-			 *                                   Data buffer
-			 *                                   Attribute buffer
-			 *     Exact size requirement false.
-			 */
-			flags = (RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
-					| RINGIO_CONTROL_CACHEUSE);
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_budgetCheck
+ *
+ *  @desc   Accounts the processing cycles of a frame against the channel
+ *          budget.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    elapsed
+ *              CLK_gethtime() counts spent processing the frame.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_runStages
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_budgetCheck(TSKRING_IO_TransferInfo * info,
+		Uint32 elapsed);
 
-			readerHandle = RingIO_open(RING_IO_READER_NAME1, RINGIO_MODE_READ,
-					flags);
-		} while (readerHandle == NULL);
-	}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_overBudget
+ *
+ *  @desc   Tells whether processing of the current frame should be cut short
+ *          because it has used up the channel budget.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    start
+ *              CLK_gethtime() value when processing of the frame started.
+ *
+ *  @ret    TRUE
+ *              Budget abort is enabled and the budget is used up.
+ *          FALSE
+ *              Otherwise.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_runStages
+ *  ----------------------------------------------------------------------------
+ */
+static Bool TSKRING_IO_overBudget(TSKRING_IO_TransferInfo * info, Uint32 start);
 
-	/* Allocate TSKRING_IO_TransferInfo structure that will be initialized
-	 * and passed to other phases of the application */
-	if (status == SYS_OK) {
-		*infoPtr = MEM_calloc(DSPLINK_SEGID, sizeof(TSKRING_IO_TransferInfo),
-				DSPLINK_BUF_ALIGN);
-		if (*infoPtr == NULL) {
-			status = SYS_EALLOC;
-			SET_FAILURE_REASON(status);
-		} else {
-			info = *infoPtr;
-		}
-	}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_runStages
+ *
+ *  @desc   Runs the channel processing stages over the frame buffer.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer, processed in place.
+ *  @arg    size
+ *              Number of bytes in the frame buffer.
+ *
+ *  @ret    SYS_OK
+ *              All stages completed.
+ *          Other
+ *              Status of the first failing stage.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_addStage
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_runStages(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size);
 
-	/* Fill up the transfer info structure */
-	if (status == SYS_OK) {
-		info->writerHandle = writerHandle;
-		info->readerHandle = readerHandle;
-		SEM_new(&(info->writerSemObj), 0);
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_runBlocks
+ *
+ *  @desc   Runs the channel processing stages over the part of the frame
+ *          buffer that has not been processed yet, up to a given end.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer, processed in place.
+ *  @arg    end
+ *              Number of bytes of the frame available in the buffer.
+ *  @arg    final
+ *              TRUE if the frame is complete. Otherwise only whole
+ *              RING_IO_STAGE_BLOCKSIZE blocks are processed and the rest is
+ *              left for a later call.
+ *
+ *  @ret    SYS_OK
+ *              All stages completed.
+ *          Other
+ *              Status of the first failing stage.
+ *
+ *  @enter  info->procOffset, info->procTime and info->procAborted have been
+ *          reset at the start of the frame.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_runStages
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_runBlocks(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 end, Bool final);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_scaleStage
+ *
+ *  @desc   Processing stage applying the scaling factor and operation
+ *          received from the GPP. Does nothing while the channel has no
+ *          operation configured, see TSKRING_IO_SCALE_ACTIVE.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer, processed in place.
+ *  @arg    size
+ *              Number of bytes in the frame buffer.
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_apply
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_scaleStage(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_scaleFastStage
+ *
+ *  @desc   Fallback variant of TSKRING_IO_scaleStage, used while the channel
+ *          is degraded. Scales by the nearest power of two of the factor
+ *          with shifts, four samples at a time, so it reads no table and
+ *          never divides. Exact for power of two factors.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer, processed in place.
+ *  @arg    size
+ *              Number of bytes in the frame buffer.
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *
+ *  @enter  buffer is word aligned, as the stage blocks are.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_scaleShift
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_scaleFastStage(TSKRING_IO_TransferInfo * info,
+		Char * buffer, Uint32 size);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_scaleTable
+ *
+ *  @desc   Looks up the shared scale lookup table of the channel's
+ *          operation and factor, dropping the previous one, and sets the
+ *          shift of the fallback stage. To be called whenever scaleOpCode
+ *          or scalingFactor change.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  Called from main() or task context.
+ *
+ *  @leave  info->scaleTable is NULL if the operation has no table or the
+ *          cache is full; the scale stage then computes the samples.
+ *
+ *  @see    RING_IO_tableGet
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_scaleTable(TSKRING_IO_TransferInfo * info);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_writeSize
+ *
+ *  @desc   Computes the size of the next writer acquire from the bytes left
+ *          in the frame and the empty space of the output RingIO, so that
+ *          every acquired buffer is released in full and never cancelled.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    remaining
+ *              Bytes of the frame still to be written.
+ *
+ *  @ret    Size to acquire, never more than remaining.
+ *
+ *  @enter  remaining is not zero.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_writeSize(TSKRING_IO_TransferInfo * info,
+		Uint32 remaining);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_readSize
+ *
+ *  @desc   Computes the size of the next reader acquire. In greedy mode all
+ *          valid data is asked for, up to the rest of the frame; the acquire
+ *          itself stops at the next attribute.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    remaining
+ *              Bytes of the frame still to be read, 0 if the frame is full
+ *              and only the end attribute is awaited.
+ *
+ *  @ret    Size to acquire.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_readSize(TSKRING_IO_TransferInfo * info,
+		Uint32 remaining);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_granule
+ *
+ *  @desc   Rounds an acquire size down to the acquire granule of the
+ *          channel, unless it is the last piece (size reaches tail) or less
+ *          than one granule.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    size
+ *              Acquire size.
+ *  @arg    tail
+ *              Bytes up to the end of the frame or segment.
+ *
+ *  @ret    Rounded size, never zero if size is not zero.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_ACQ_GRANULE
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_granule(TSKRING_IO_TransferInfo * info, Uint32 size,
+		Uint32 tail);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_outNotify
+ *
+ *  @desc   Sends a notification to the GPP reader of the output RingIO,
+ *          subject to the moderation of the channel. With moderation on,
+ *          the end of frame notification is sent once enough frames or
+ *          bytes are pending or the timer has marked it due. Start of frame
+ *          notifications are folded into it: the GPP reader woken by it
+ *          finds the start attribute ahead of the frame data, and sending
+ *          the start on its own would double the notifications moderation
+ *          saves. Frames whose notification fails to go out stay pending.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    msg
+ *              NOTIFY_DATA_START or NOTIFY_DATA_END.
+ *  @arg    size
+ *              Bytes written for the frame, for NOTIFY_DATA_END.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              Notification sent or deferred.
+ *          Otherwise
+ *              Status of RingIO_sendNotify.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_notifyTick
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_outNotify(TSKRING_IO_TransferInfo * info,
+		RingIO_NotifyMsg msg, Uint32 size);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_notifyFlush
+ *
+ *  @desc   Sends the end of frame notification the timer has marked due, in
+ *          task context. The frames stay pending if it fails to go out.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_notifyTick
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_notifyFlush(TSKRING_IO_TransferInfo * info);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_eventPut
+ *
+ *  @desc   Puts a notification on the event queue of the channel. Called
+ *          only from the reader notification callback. Data notifications
+ *          other than the start are not queued, the semaphore posted with
+ *          them is enough to wake the task.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    msg
+ *              Notification message.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_eventGet
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_eventPut(TSKRING_IO_TransferInfo * info,
+		RingIO_NotifyMsg msg);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_eventGet
+ *
+ *  @desc   Takes the next event from the event queue of the channel: a
+ *          self-test request, the queued starts, the folded starts, then
+ *          the exit. Called only from the channel task.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    event
+ *              Location to receive the event.
+ *
+ *  @ret    TRUE
+ *              An event was taken.
+ *          FALSE
+ *              The queue is empty.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_eventPut
+ *  ----------------------------------------------------------------------------
+ */
+static Bool TSKRING_IO_eventGet(TSKRING_IO_TransferInfo * info,
+		TSKRING_IO_Event * event);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_eventInit
+ *
+ *  @desc   Empties the event queue of the channel.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  No notifier is set on the reader yet.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_eventPut
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_eventInit(TSKRING_IO_TransferInfo * info);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_waitStart
+ *
+ *  @desc   Takes events in order until a NOTIFY_DATA_START or NOTIFY_DSP_END,
+ *          pending on the reader semaphore while the queue is empty and
+ *          taking the count posted with each event it takes. The GPP
+ *          sets the start attribute before it sends the start notification,
+ *          so the attribute is read once per start event. A start event
+ *          without a start attribute at the read position is counted and
+ *          the wait goes on. The start event sets the arrival time of the
+ *          frame, the end event sets exitflag.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    param
+ *              Location to receive the parameter of the start attribute.
+ *  @arg    packSize
+ *              Location to receive the size of the first chunk when the start
+ *              came in a packed record, else left alone.
+ *  @arg    frameEnd
+ *              Location set to TRUE when the packed record also ends the
+ *              frame, right away or after the chunk of *packSize bytes,
+ *              else left alone.
+ *
+ *  @ret    SYS_OK
+ *              Start or exit event taken.
+ *          RINGIO_EFAILURE
+ *              SEM_pend failed.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_exitCheck
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_waitStart(TSKRING_IO_TransferInfo * info,
+		Uint32 * param, Uint32 * packSize, Bool * frameEnd);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_exitCheck
+ *
+ *  @desc   Sets exitflag if a NOTIFY_DSP_END has arrived, without taking the
+ *          events ahead of it.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_waitStart
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_exitCheck(TSKRING_IO_TransferInfo * info);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_repeatHit
+ *
+ *  @desc   Checks whether the frame repeats the last processed one: same
+ *          size and scale parameters and the same input, compared in full
+ *          once the hashes match. On a hit the cached output is put in the
+ *          frame buffer, or with repeatAttr the frame is marked to go out as
+ *          a RINGIO_DATA_REPEAT attribute. On a miss the input of an
+ *          eligible frame is kept for the next check. Degraded frames are
+ *          not eligible, their output comes from the fallback stages.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer.
+ *  @arg    size
+ *              Number of bytes in the frame buffer.
+ *
+ *  @ret    TRUE
+ *              The frame repeats, the stages are skipped.
+ *          FALSE
+ *              The frame must be processed.
+ *
+ *  @enter  info->frameHash covers the whole frame.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_repeatSave
+ *  ----------------------------------------------------------------------------
+ */
+static Bool TSKRING_IO_repeatHit(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_repeatSave
+ *
+ *  @desc   Keeps the output of a processed frame for the repeated frame
+ *          check. Only done for a frame whose input repeatHit kept, that
+ *          ran all its stages, and only when the output is sent again
+ *          (no repeatAttr).
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Processed frame buffer.
+ *  @arg    size
+ *              Number of bytes in the frame buffer.
+ *
+ *  @ret    None
+ *
+ *  @enter  TSKRING_IO_repeatHit has been called for the frame.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_repeatHit
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_repeatSave(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_readFrame
+ *
+ *  @desc   Reads the data of a frame from the input RingIO into the frame
+ *          buffer, up to its end attribute, taking the size and format
+ *          attributes on the way. With the copy engine, the stages run on
+ *          the blocks already in the buffer while each chunk is copied.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer.
+ *  @arg    acqSize
+ *              Size of the frame buffer, and of a full reader acquire.
+ *  @arg    packSize
+ *              Size of the first chunk from a packed start record, else 0.
+ *  @arg    frameEnd
+ *              TRUE if the start record also ended the frame.
+ *
+ *  @ret    Bytes of the frame read. Only the first acqSize are in buffer.
+ *
+ *  @enter  The start of the frame has been taken, see TSKRING_IO_waitStart.
+ *
+ *  @leave  info->exitflag is set if NOTIFY_DSP_END came in meanwhile.
+ *
+ *  @see    TSKRING_IO_writeFrame
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_readFrame(TSKRING_IO_TransferInfo * info,
+		Char * buffer, Uint32 acqSize, Uint32 packSize, Bool frameEnd);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_prefetchNext
+ *
+ *  @desc   Invalidates the input span just acquired unless the prefetch
+ *          already did, then invalidates and touches the next pending span:
+ *          from the end of the acquired one, or from the start of the data
+ *          buffer at its end, up to the valid size of the input RingIO.
+ *          The bounds of the data buffer are learnt when the reader wraps:
+ *          an acquire that does not start where the previous one ended
+ *          starts the buffer, and the previous one ended it. Nothing is
+ *          touched before that.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    limit
+ *              Largest span to touch, in bytes.
+ *
+ *  @ret    None
+ *
+ *  @enter  info->readerBuf and info->readerRecvSize are the span just
+ *          acquired. The input RingIO was opened without
+ *          RINGIO_DATABUF_CACHEUSE.
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_prefetch, RING_IO_PREFETCH
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_prefetchNext(TSKRING_IO_TransferInfo * info,
+		Uint32 limit);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_writeFrame
+ *
+ *  @desc   Writes a processed frame to the output RingIO: the start
+ *          attribute and NOTIFY_DATA_START, the shed or pass-through mark,
+ *          the data with a size attribute per chunk, the end attribute and
+ *          NOTIFY_DATA_END. With packed attributes, these go out as
+ *          RINGIO_DATA_PACKED records.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    buffer
+ *              Frame buffer.
+ *  @arg    size
+ *              Bytes of the frame.
+ *  @arg    bufSize
+ *              Size of the frame buffer.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The frame has been written.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_readFrame
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_writeFrame(TSKRING_IO_TransferInfo * info,
+		Char * buffer, Uint32 size, Uint32 bufSize);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_selfTest
+ *
+ *  @desc   Loopback self-benchmark, run on NOTIFY_DSP_SELFTEST. Generates
+ *          RING_IO_SELFTEST_FRAMES frames into a local input RingIO and
+ *          passes each through the frame loop code, TSKRING_IO_readFrame,
+ *          the channel stages and TSKRING_IO_writeFrame, run on a copy of
+ *          the channel whose handles are the local RingIOs. Only that
+ *          channel side of the path is timed; generating the frames and
+ *          draining the output RingIO are not. The results go to the
+ *          self-test fields of info->stats. The GPP takes no part beyond
+ *          the trigger.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    SYS_OK
+ *              The self-test has completed.
+ *          Else
+ *              Status of the failed RingIO or memory call.
+ *
+ *  @enter  Called by the channel task between frames.
+ *
+ *  @leave  The local RingIOs are deleted.
+ *
+ *  @see    TSKRING_IO_selfMove
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_selfTest(TSKRING_IO_TransferInfo * info);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_selfMove
+ *
+ *  @desc   Feeds a generated frame into the input RingIO of the self-test,
+ *          or drains one from its output RingIO, a span at a time. The
+ *          writer sets the size attribute of each acquired span and the end
+ *          attribute after the frame, as the GPP does. The reader takes the
+ *          attributes it meets on the way.
+ *
+ *  @arg    handle
+ *              Handle of the RingIO.
+ *  @arg    buffer
+ *              Buffer to copy from (writer) or to (reader), NULL to only
+ *              acquire and release.
+ *  @arg    size
+ *              Number of bytes to move.
+ *  @arg    writer
+ *              TRUE if handle is a writer.
+ *
+ *  @ret    SYS_OK
+ *              The bytes have been moved.
+ *          Else
+ *              Status of the failed RingIO call.
+ *
+ *  @enter  The RingIO has room for (writer) or holds (reader) size bytes.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_selfTest
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_selfMove(RingIO_Handle handle, Char * buffer,
+		Uint32 size, Bool writer);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_packPut
+ *
+ *  @desc   Adds a key/value pair to the pending packed record of the output
+ *          RingIO. A key already in the record gets the new value.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    key
+ *              Fixed attribute type or RING_IO_PACK_SIZE.
+ *  @arg    value
+ *              Attribute parameter or chunk size.
+ *
+ *  @ret    None
+ *
+ *  @enter  info->packAttrs is TRUE.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_packFlush
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_packPut(TSKRING_IO_TransferInfo * info, Uint32 key,
+		Uint32 value);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_packFlush
+ *
+ *  @desc   Sets the pending packed record as a RINGIO_DATA_PACKED attribute
+ *          on the output RingIO. If it holds the start of the frame,
+ *          NOTIFY_DATA_START is sent once it is set.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *
+ *  @ret    RINGIO_SUCCESS
+ *              The record has been set, or none was pending.
+ *          Else
+ *              Status of RingIO_setvAttribute. The record stays pending.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_packPut
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_packFlush(TSKRING_IO_TransferInfo * info);
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_unpack
+ *
+ *  @desc   Applies a packed record taken from the input RingIO into
+ *          info->packIn. A RINGIO_DATA_FORMAT key sets the sample format.
+ *
+ *  @arg    info
+ *              Information for transfer.
+ *  @arg    bytes
+ *              Size of the record in bytes.
+ *  @arg    stamp
+ *              Location to receive the value of a RINGIO_DATA_START key.
+ *  @arg    size
+ *              Location to receive the value of a RING_IO_PACK_SIZE key.
+ *
+ *  @ret    Set of the keys found, see RING_IO_PACK_BIT.
+ *
+ *  @enter  The record is in info->packIn.
+ *
+ *  @leave  *stamp and *size are unchanged if their key is absent.
+ *
+ *  @see    RINGIO_DATA_PACKED
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_unpack(TSKRING_IO_TransferInfo * info, Uint32 bytes,
+		Uint32 * stamp, Uint32 * size);
+
+/*  ============================================================================
+ *  Hot path placement. The frame loop, notification callbacks and stages are
+ *  collected in .text:ringio_hot, which the platform linker profile
+ *  (ring_io_hot.cmd) maps to on-chip program memory.
+ *  ============================================================================
+ */
+#if defined (_TMS320C6X)
+#pragma CODE_SECTION (TSKRING_IO_execute1, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_execute2, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_reader_notify, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_writer_notify, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_shedCheck, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_degradeCheck, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_jitterWait, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_markFrame, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_frameDone, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_runStages, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_runBlocks, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_overBudget, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_budgetCheck, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_scaleStage, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_scaleFastStage, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_usToHtime, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_writeSize, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_readSize, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_granule, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_outNotify, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_notifyFlush, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_eventPut, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_eventGet, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_waitStart, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_exitCheck, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_readFrame, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_prefetchNext, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_writeFrame, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_repeatHit, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_repeatSave, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_packPut, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_packFlush, ".text:ringio_hot")
+#pragma CODE_SECTION (TSKRING_IO_unpack, ".text:ringio_hot")
+#endif /* if defined (_TMS320C6X) */
+
+#if defined (DSP_BOOTMODE_NOBOOT)
+/** ============================================================================
+ *  @name   smaPoolObj
+ *
+ *  @desc   Global object for pool parameters for the dynamic POOL_open call
+ *  ============================================================================
+ */
+SMAPOOL_Params smaPoolObj;
+#endif
+/** ============================================================================
+ *  @func   TSKRING_IO_create
+ *
+ *  @desc   Create phase function for the RING_IO application. Initializes the
+ *          TSKRING_IO_TransferInfo structure with the information that will be
+ *          used by the other phases of the application.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+Int TSKRING_IO_create1(TSKRING_IO_TransferInfo ** infoPtr) {
+	Int status = SYS_OK;
+	TSKRING_IO_TransferInfo * info = NULL;
+	RingIO_Attrs ringIoAttrs;
+	Uint32 flags;
+	RingIO_Handle writerHandle;
+	RingIO_Handle readerHandle;
+	Char writerName[RING_IO_NAME_LEN];
+	Char readerName[RING_IO_NAME_LEN];
+
+	/* Names of the RingIOs of the channel on this DSP */
+	status = RING_IO_placeName(writerName, RING_IO_WRITER_NAME1,
+			RING_IO_PLACE1, GBL_getProcId());
+	if (status == SYS_OK) {
+		status = RING_IO_placeName(readerName, RING_IO_READER_NAME1,
+				RING_IO_PLACE1, GBL_getProcId());
+	}
+	if (status != SYS_OK) {
+		SET_FAILURE_REASON(status);
+	}
+
+	/*
+	 *  Create the RingIO to be used with DSP as the writer.
+	 */
+	if (status == SYS_OK) {
+		ringIoAttrs.transportType = RINGIO_TRANSPORT_GPP_DSP;
+		ringIoAttrs.ctrlPoolId = SAMPLE_POOL_ID;
+		ringIoAttrs.dataPoolId = SAMPLE_POOL_ID;
+		ringIoAttrs.attrPoolId = SAMPLE_POOL_ID;
+		ringIoAttrs.lockPoolId = SAMPLE_POOL_ID;
+		ringIoAttrs.dataBufSize = RING_IO_dataBufSize1;
+		ringIoAttrs.footBufSize = RING_IO_footBufSize;
+		ringIoAttrs.attrBufSize = RING_IO_attrBufSize;
+
+#if defined (DSPLINK_LEGACY_SUPPORT)
+		status = RingIO_create (writerName, &ringIoAttrs);
+#else
+		status = RingIO_create(GBL_getProcId(), writerName, &ringIoAttrs);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+		if (status != SYS_OK) {
+			SET_FAILURE_REASON(status);
+		}
+	}
+
+	/*
+	 *  Open the RingIO to be used with DSP as the writer.
+	 */
+	if (status == SYS_OK) {
+		/* Value of the flags indicates:
+		 *     Cache coherence required for: Control structure
+		 *                                   Data buffer
+		 *                                   Attribute buffer
+		 *     Exact size requirement unless the writer is flexible.
+		 */
+		flags = RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
+				| RINGIO_CONTROL_CACHEUSE;
+		if (RING_IO_WRITER_FLEXIBLE1 == FALSE) {
+			flags |= RINGIO_NEED_EXACT_SIZE;
+		}
+		do {
+			writerHandle = RingIO_open(writerName, RINGIO_MODE_WRITE, flags);
+			if (writerHandle == NULL) {
+				status = RINGIO_EFAILURE;
+				SET_FAILURE_REASON(status);
+			}
+		} while (writerHandle == NULL);
+	}
+
+	/*
+	 *  Open the RingIO to be used with DSP as the reader.
+	 */
+	if (status == SYS_OK) {
+		/* Wait till the RingIO is created by the GPP. */
+		do {
+			/* Value of the flags indicates:
+			 *     Cache coherence required for: Control structure
+			 *                                   Data buffer
+			 *                                   Attribute buffer
+			 *     Exact size requirement false.
+			 */
+			flags = (RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
+					| RINGIO_CONTROL_CACHEUSE);
+			if (RING_IO_PREFETCH1 == TRUE) {
+				/* The reader keeps the data buffer coherent itself */
+				flags &= ~RINGIO_DATABUF_CACHEUSE;
+			}
+
+			readerHandle = RingIO_open(readerName, RINGIO_MODE_READ, flags);
+		} while (readerHandle == NULL);
+	}
+
+	/* Allocate TSKRING_IO_TransferInfo structure that will be initialized
+	 * and passed to other phases of the application */
+	if (status == SYS_OK) {
+		*infoPtr = MEM_calloc(DSPLINK_SEGID, sizeof(TSKRING_IO_TransferInfo),
+				DSPLINK_BUF_ALIGN);
+		if (*infoPtr == NULL) {
+			status = SYS_EALLOC;
+			SET_FAILURE_REASON(status);
+		} else {
+			info = *infoPtr;
+		}
+	}
+
+	/* Fill up the transfer info structure */
+	if (status == SYS_OK) {
+		info->writerHandle = writerHandle;
+		info->readerHandle = readerHandle;
+		strcpy(info->writerName, writerName);
+		strcpy(info->readerName, readerName);
+		SEM_new(&(info->writerSemObj), 0);
 		SEM_new(&(info->readerSemObj), 0);
 		info->readerRecvSize = 0;
 		info->writerRecvSize = 0;
 		/* Set the flags to false */
-		info->freadStart = FALSE;
-		info->freadEnd = FALSE;
+		TSKRING_IO_eventInit(info);
 		info->exitflag = FALSE;
+		/* Load shedding configuration */
+		info->shedPolicy = RING_IO_SHED_POLICY1;
+		info->shedNth = RING_IO_SHED_NTH1;
+		info->shedFillMark = RING_IO_SHED_FILLMARK1;
+		info->shedLowMark = RING_IO_SHED_LOWMARK1;
+		info->shedDeadline = TSKRING_IO_usToHtime(RING_IO_SHED_DEADLINE1);
+		info->shedMissLimit = RING_IO_SHED_MISSLIMIT;
+
+		/* Jitter buffer configuration */
+		info->jitterMinDelay = TSKRING_IO_usToHtime(RING_IO_JITTER_DELAY1);
+		info->jitterMaxDelay = TSKRING_IO_usToHtime(RING_IO_JITTER_MAXDELAY1);
+		info->jitterDelay = info->jitterMinDelay;
+
+		/* Processing budget */
+		info->cyclesPerHtime = CLK_cpuCyclesPerHtime();
+		info->budget = RING_IO_BUDGET1;
+		info->budgetHtime = (Uint32) ((Float) RING_IO_BUDGET1
+				/ info->cyclesPerHtime);
+		info->budgetAbort = RING_IO_BUDGET_ABORT1;
+
+		/* RingIO acquire sizing */
+		info->greedyRead = RING_IO_READ_GREEDY1;
+		info->writerFlexible = RING_IO_WRITER_FLEXIBLE1;
+		info->acqGranule = RING_IO_ACQ_GRANULE1;
+		info->sampleFormat = RING_IO_SAMPLE_FORMAT1;
+		info->asyncCopy = RING_IO_ASYNC_COPY1;
+		info->copyEngine = 0;
+		info->prefetchNext = RING_IO_PREFETCH1;
+		info->repeatCheck = RING_IO_REPEAT_CHECK1;
+		info->repeatAttr = RING_IO_REPEAT_ATTR1;
+		info->packAttrs = RING_IO_PACK_ATTRS1;
+		info->packStart = FALSE;
+		info->packWords = 0;
+
+		/* Output notification moderation */
+		info->notifyFrames = RING_IO_NOTIFY_FRAMES1;
+		info->notifyBytes = RING_IO_NOTIFY_BYTES1;
+		info->notifyPeriod = TSKRING_IO_usToHtime(RING_IO_NOTIFY_PERIOD1);
+		if (((info->notifyFrames > 1u) || (info->notifyBytes != 0))
+				&& (info->notifyPeriod != 0)) {
+			/* Served by the notification timer */
+			TSKRING_IO_channels[0] = info;
+		}
+
+		/* Processing stages */
+		info->numStages = 0;
+		info->degraded = FALSE;
+		info->degradeLoadHi = RING_IO_DEGRADE_LOADHI1;
+		info->degradeLoadLo = RING_IO_DEGRADE_LOADLO1;
+		info->degradeFillHi = RING_IO_DEGRADE_FILLHI1;
+		info->degradeFillLo = RING_IO_DEGRADE_FILLLO1;
+		status = TSKRING_IO_addStage(info, &TSKRING_IO_scaleStage,
+				&TSKRING_IO_scaleFastStage);
+#if defined (RING_IO_FIXED_CONFIG)
+		info->scaleOpCode = RING_IO_FIXED_OPCODE;
+		info->scalingFactor = RING_IO_FIXED_FACTOR;
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+		TSKRING_IO_scaleTable(info);
 	}
 
 	return (status);
@@ -447,6 +1368,19 @@ Int TSKRING_IO_create2(TSKRING_IO_TransferInfo ** infoPtr) {
 	Uint32 flags;
 	RingIO_Handle writerHandle;
 	RingIO_Handle readerHandle;
+	Char writerName[RING_IO_NAME_LEN];
+	Char readerName[RING_IO_NAME_LEN];
+
+	/* Names of the RingIOs of the channel on this DSP */
+	status = RING_IO_placeName(writerName, RING_IO_WRITER_NAME2,
+			RING_IO_PLACE2, GBL_getProcId());
+	if (status == SYS_OK) {
+		status = RING_IO_placeName(readerName, RING_IO_READER_NAME2,
+				RING_IO_PLACE2, GBL_getProcId());
+	}
+	if (status != SYS_OK) {
+		SET_FAILURE_REASON(status);
+	}
 
 	/*
 	 *  Create the RingIO to be used with DSP as the writer.
@@ -462,10 +1396,9 @@ Int TSKRING_IO_create2(TSKRING_IO_TransferInfo ** infoPtr) {
 		ringIoAttrs.attrBufSize = RING_IO_attrBufSize;
 
 #if defined (DSPLINK_LEGACY_SUPPORT)
-		status = RingIO_create (RING_IO_WRITER_NAME2, &ringIoAttrs);
+		status = RingIO_create (writerName, &ringIoAttrs);
 #else
-		status = RingIO_create(GBL_getProcId(), RING_IO_WRITER_NAME2,
-				&ringIoAttrs);
+		status = RingIO_create(GBL_getProcId(), writerName, &ringIoAttrs);
 #endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
 		if (status != SYS_OK) {
 			SET_FAILURE_REASON(status);
@@ -480,13 +1413,15 @@ Int TSKRING_IO_create2(TSKRING_IO_TransferInfo ** infoPtr) {
 		 *     Cache coherence required for: Control structure
 		 *                                   Data buffer
 		 *                                   Attribute buffer
-		 *     Exact size requirement.
+		 *     Exact size requirement unless the writer is flexible.
 		 */
 		flags = RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
-				| RINGIO_CONTROL_CACHEUSE | RINGIO_NEED_EXACT_SIZE;
+				| RINGIO_CONTROL_CACHEUSE;
+		if (RING_IO_WRITER_FLEXIBLE2 == FALSE) {
+			flags |= RINGIO_NEED_EXACT_SIZE;
+		}
 		do {
-			writerHandle = RingIO_open(RING_IO_WRITER_NAME2, RINGIO_MODE_WRITE,
-					flags);
+			writerHandle = RingIO_open(writerName, RINGIO_MODE_WRITE, flags);
 			if (writerHandle == NULL) {
 				status = RINGIO_EFAILURE;
 				SET_FAILURE_REASON(status);
@@ -508,9 +1443,12 @@ Int TSKRING_IO_create2(TSKRING_IO_TransferInfo ** infoPtr) {
 			 */
 			flags = (RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
 					| RINGIO_CONTROL_CACHEUSE);
+			if (RING_IO_PREFETCH2 == TRUE) {
+				/* The reader keeps the data buffer coherent itself */
+				flags &= ~RINGIO_DATABUF_CACHEUSE;
+			}
 
-			readerHandle = RingIO_open(RING_IO_READER_NAME2, RINGIO_MODE_READ,
-					flags);
+			readerHandle = RingIO_open(readerName, RINGIO_MODE_READ, flags);
 		} while (readerHandle == NULL);
 	}
 
@@ -527,1136 +1465,2511 @@ Int TSKRING_IO_create2(TSKRING_IO_TransferInfo ** infoPtr) {
 		}
 	}
 
-	/* Fill up the transfer info structure */
-	if (status == SYS_OK) {
-		info->writerHandle = writerHandle;
-		info->readerHandle = readerHandle;
-		SEM_new(&(info->writerSemObj), 0);
-		SEM_new(&(info->readerSemObj), 0);
-		info->readerRecvSize = 0;
-		info->writerRecvSize = 0;
-		/* Set the flags to false */
-		info->freadStart = FALSE;
-		info->freadEnd = FALSE;
-		info->exitflag = FALSE;
+	/* Fill up the transfer info structure */
+	if (status == SYS_OK) {
+		info->writerHandle = writerHandle;
+		info->readerHandle = readerHandle;
+		strcpy(info->writerName, writerName);
+		strcpy(info->readerName, readerName);
+		SEM_new(&(info->writerSemObj), 0);
+		SEM_new(&(info->readerSemObj), 0);
+		info->readerRecvSize = 0;
+		info->writerRecvSize = 0;
+		/* Set the flags to false */
+		TSKRING_IO_eventInit(info);
+		info->exitflag = FALSE;
+		/* Load shedding configuration */
+		info->shedPolicy = RING_IO_SHED_POLICY2;
+		info->shedNth = RING_IO_SHED_NTH2;
+		info->shedFillMark = RING_IO_SHED_FILLMARK2;
+		info->shedLowMark = RING_IO_SHED_LOWMARK2;
+		info->shedDeadline = TSKRING_IO_usToHtime(RING_IO_SHED_DEADLINE2);
+		info->shedMissLimit = RING_IO_SHED_MISSLIMIT;
+
+		/* Jitter buffer configuration */
+		info->jitterMinDelay = TSKRING_IO_usToHtime(RING_IO_JITTER_DELAY2);
+		info->jitterMaxDelay = TSKRING_IO_usToHtime(RING_IO_JITTER_MAXDELAY2);
+		info->jitterDelay = info->jitterMinDelay;
+
+		/* Processing budget */
+		info->cyclesPerHtime = CLK_cpuCyclesPerHtime();
+		info->budget = RING_IO_BUDGET2;
+		info->budgetHtime = (Uint32) ((Float) RING_IO_BUDGET2
+				/ info->cyclesPerHtime);
+		info->budgetAbort = RING_IO_BUDGET_ABORT2;
+
+		/* RingIO acquire sizing */
+		info->greedyRead = RING_IO_READ_GREEDY2;
+		info->writerFlexible = RING_IO_WRITER_FLEXIBLE2;
+		info->acqGranule = RING_IO_ACQ_GRANULE2;
+		info->sampleFormat = RING_IO_SAMPLE_FORMAT2;
+		info->asyncCopy = RING_IO_ASYNC_COPY2;
+		info->copyEngine = 1u;
+		info->prefetchNext = RING_IO_PREFETCH2;
+		info->repeatCheck = RING_IO_REPEAT_CHECK2;
+		info->repeatAttr = RING_IO_REPEAT_ATTR2;
+		info->packAttrs = RING_IO_PACK_ATTRS2;
+		info->packStart = FALSE;
+		info->packWords = 0;
+
+		/* Output notification moderation */
+		info->notifyFrames = RING_IO_NOTIFY_FRAMES2;
+		info->notifyBytes = RING_IO_NOTIFY_BYTES2;
+		info->notifyPeriod = TSKRING_IO_usToHtime(RING_IO_NOTIFY_PERIOD2);
+		if (((info->notifyFrames > 1u) || (info->notifyBytes != 0))
+				&& (info->notifyPeriod != 0)) {
+			/* Served by the notification timer */
+			TSKRING_IO_channels[1] = info;
+		}
+
+		/* Processing stages */
+		info->numStages = 0;
+		info->degraded = FALSE;
+		info->degradeLoadHi = RING_IO_DEGRADE_LOADHI2;
+		info->degradeLoadLo = RING_IO_DEGRADE_LOADLO2;
+		info->degradeFillHi = RING_IO_DEGRADE_FILLHI2;
+		info->degradeFillLo = RING_IO_DEGRADE_FILLLO2;
+		status = TSKRING_IO_addStage(info, &TSKRING_IO_scaleStage,
+				&TSKRING_IO_scaleFastStage);
+#if defined (RING_IO_FIXED_CONFIG)
+		info->scaleOpCode = RING_IO_FIXED_OPCODE;
+		info->scalingFactor = RING_IO_FIXED_FACTOR;
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+		TSKRING_IO_scaleTable(info);
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   TSKRING_IO_execute
+ *
+ *  @desc   Execute phase function for the RingIO sample application. Application
+ *          receives the data from the input RingIO and  processes data
+ *          as specified by the attributes from GPP.Sends the same data
+ *          back on output RingIO .
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+Int TSKRING_IO_execute1(TSKRING_IO_TransferInfo * info) {
+	Int status = SYS_OK;
+	Int wrRingStatus = RINGIO_SUCCESS;
+	Bool exitFlag = FALSE;
+	Uint32 param;
+	Uint32 writerWaterMark;
+	Uint32 readerAcqSize;
+	Uint32 size;
+	Uint32 packSize = 0;
+	Uint32 totalRcvbytes = 0;
+	Char * Buffer;
+
+#if defined (RING_IO_FIXED_CONFIG)
+	RING_IO_dataBufSize3 = RING_IO_FIXED_FRAMESIZE;
+#else
+	RING_IO_dataBufSize3 = 1024;   // the DSP reader size
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+
+	/*
+	 *  Set the notification for Writer.
+	 */
+	//writerWaterMark
+	//		= (RING_IO_dataBufSize1 < RINGIO_WRITE_ACQ_SIZE) ? RING_IO_dataBufSize1
+	//				: RINGIO_WRITE_ACQ_SIZE;
+	//writerWaterMark = RING_IO_dataBufSize1;
+	writerWaterMark = RINGIO_WRITE_ACQ_SIZE;
+
+	do {
+		status = RingIO_setNotifier(info->writerHandle,
+				RINGIO_NOTIFICATION_ONCE, writerWaterMark,
+				&TSKRING_IO_writer_notify, (RingIO_NotifyParam) info);
+	} while (status != SYS_OK);
+
+	/*
+	 *  Set the notification for Reader.
+	 */
+	// readerAcqSize = (RING_IO_dataBufSize3 < RINGIO_READ_ACQ_SIZE)?
+	//                 RING_IO_dataBufSize3 : RINGIO_READ_ACQ_SIZE ;
+
+
+	readerAcqSize = RING_IO_dataBufSize3;   //GPP size[0]
+	Buffer = MEM_calloc(DSPLINK_SEGID, readerAcqSize, DSPLINK_BUF_ALIGN);
+	if(NULL == Buffer) {
+		status = RINGIO_EFAILURE;
+		SET_FAILURE_REASON(status);
+	}
+
+	/* Input and output of the last processed frame, for the repeated
+	 * frame check
+	 */
+	if (info->repeatCheck == TRUE) {
+		info->repeatValid = FALSE;
+		info->repeatBuf = MEM_calloc(DSPLINK_SEGID, 2u * readerAcqSize,
+				DSPLINK_BUF_ALIGN);
+		if (info->repeatBuf == NULL) {
+			/* Run without the check */
+			info->repeatCheck = FALSE;
+			SET_FAILURE_REASON(SYS_EALLOC);
+		} else {
+			info->repeatOut = info->repeatBuf + RING_IO_MAUS(readerAcqSize);
+		}
+	}
+
+	do {
+		status = RingIO_setNotifier(info->readerHandle,
+				RINGIO_NOTIFICATION_ONCE, 0 /* readerWaterMark */,
+				&TSKRING_IO_reader_notify, (RingIO_NotifyParam) info);
+	} while (status != SYS_OK);
+
+	//while (1) {
+	while (!info->exitflag) {
+
+		/* Wait for the start notification and attribute from gpp */
+		status = TSKRING_IO_waitStart(info, &param, &packSize, &exitFlag);
+
+		if ((status == SYS_OK) && (!info->exitflag)) {
+
+			/* Hold the frame in the input RingIO until its release slot */
+			if (!info->exitflag) {
+				TSKRING_IO_jitterWait(info, param);
+			}
+		}
+
+		/* Decide whether this frame is processed, passed or dropped */
+		TSKRING_IO_shedCheck(info);
+		TSKRING_IO_degradeCheck(info);
+		info->procOffset = 0;
+		info->procTime = 0;
+		info->procAborted = FALSE;
+		info->frameHash = RING_IO_HASH_INIT;
+		info->repeatFrame = FALSE;
+
+		totalRcvbytes = TSKRING_IO_readFrame(info, Buffer, readerAcqSize,
+				packSize, exitFlag);
+		packSize = 0;
+		exitFlag = FALSE;
+
+		///////////////////////////////////////////////////////////////////////////////
+		//End  the read  task
+		///////////////////////////////////////////////////////////////////////////////
+
+
+		///////////////////////////////////////////////////////////////////////////////
+		//To do the algorithms with the Buffer (RING_IO_dataBufSize3)
+		///////////////////////////////////////////////////////////////////////////////
+		if ((!info->dropFrame) && (!info->passFrame) && (!info->exitflag)) {
+			size = (totalRcvbytes < readerAcqSize) ? totalRcvbytes
+					: readerAcqSize;
+			if (TSKRING_IO_repeatHit(info, Buffer, size) == FALSE) {
+				TSKRING_IO_runStages(info, Buffer, size);
+				TSKRING_IO_repeatSave(info, Buffer, size);
+			}
+		}
+
+
+		///////////////////////////////////////////////////////////////////////////////
+		//END To do the algorithms with the Buffer (RING_IO_dataBufSize3)
+		///////////////////////////////////////////////////////////////////////////////
+
+
+		///////////////////////////////////////////////////////////////////////////////
+		//start  the write  task
+		///////////////////////////////////////////////////////////////////////////////
+
+		if (RINGIO_SUCCESS == wrRingStatus) {
+			wrRingStatus = TSKRING_IO_writeFrame(info, Buffer, totalRcvbytes,
+					readerAcqSize);
+		}
+		totalRcvbytes = 0;
+
+		TSKRING_IO_frameDone(info);
+	}
+	status = MEM_free(DSPLINK_SEGID, Buffer, RING_IO_dataBufSize3);
+	if (info->repeatBuf != NULL) {
+		MEM_free(DSPLINK_SEGID, info->repeatBuf, 2u * RING_IO_dataBufSize3);
+		info->repeatBuf = NULL;
+	}
+	
+
+
+	return (status);
+}
+
+Int TSKRING_IO_execute2(TSKRING_IO_TransferInfo * info) {
+	Int status = SYS_OK;
+	Int wrRingStatus = RINGIO_SUCCESS;
+	Bool exitFlag = FALSE;
+	Uint32 param;
+	Uint32 writerWaterMark;
+	Uint32 readerAcqSize;
+	Uint32 size;
+	Uint32 packSize = 0;
+	Uint32 totalRcvbytes = 0;
+	Char * Buffer;
+
+#if defined (RING_IO_FIXED_CONFIG)
+	RING_IO_dataBufSize4 = RING_IO_FIXED_FRAMESIZE;
+#else
+	RING_IO_dataBufSize4 = 2048;  //The DSP reader Size
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+
+	/*
+	 *  Set the notification for Writer.
+	 */
+	//writerWaterMark
+	//		= (RING_IO_dataBufSize2 < RINGIO_WRITE_ACQ_SIZE) ? RING_IO_dataBufSize2
+	//				: RINGIO_WRITE_ACQ_SIZE;
+	//writerWaterMark= RING_IO_dataBufSize2;
+	writerWaterMark= RINGIO_WRITE_ACQ_SIZE;
+
+	do {
+		status = RingIO_setNotifier(info->writerHandle,
+				RINGIO_NOTIFICATION_ONCE, writerWaterMark,
+				&TSKRING_IO_writer_notify, (RingIO_NotifyParam) info);
+	} while (status != SYS_OK);
+
+	/*
+	 *  Set the notification for Reader.
+	 */
+	// readerAcqSize = (RING_IO_dataBufSize3 < RINGIO_READ_ACQ_SIZE)?
+	//                 RING_IO_dataBufSize3 : RINGIO_READ_ACQ_SIZE ;
+
+
+	readerAcqSize = RING_IO_dataBufSize4;
+	Buffer = MEM_calloc(DSPLINK_SEGID, readerAcqSize, DSPLINK_BUF_ALIGN);
+	if(NULL == Buffer) {
+		status = RINGIO_EFAILURE;
+		SET_FAILURE_REASON(status);
+	}
+
+	/* Input and output of the last processed frame, for the repeated
+	 * frame check
+	 */
+	if (info->repeatCheck == TRUE) {
+		info->repeatValid = FALSE;
+		info->repeatBuf = MEM_calloc(DSPLINK_SEGID, 2u * readerAcqSize,
+				DSPLINK_BUF_ALIGN);
+		if (info->repeatBuf == NULL) {
+			/* Run without the check */
+			info->repeatCheck = FALSE;
+			SET_FAILURE_REASON(SYS_EALLOC);
+		} else {
+			info->repeatOut = info->repeatBuf + RING_IO_MAUS(readerAcqSize);
+		}
+	}
+
+	do {
+		status = RingIO_setNotifier(info->readerHandle,
+				RINGIO_NOTIFICATION_ONCE, 0 /* readerWaterMark */,
+				&TSKRING_IO_reader_notify, (RingIO_NotifyParam) info);
+	} while (status != SYS_OK);
+
+	//while (1) {
+	while (!info->exitflag) {
+
+
+		/* Wait for the start notification and attribute from gpp */
+		status = TSKRING_IO_waitStart(info, &param, &packSize, &exitFlag);
+
+		if ((status == SYS_OK) && (!info->exitflag)) {
+
+			/* Hold the frame in the input RingIO until its release slot */
+			if (!info->exitflag) {
+				TSKRING_IO_jitterWait(info, param);
+			}
+		}
+
+		/* Decide whether this frame is processed, passed or dropped */
+		TSKRING_IO_shedCheck(info);
+		TSKRING_IO_degradeCheck(info);
+		info->procOffset = 0;
+		info->procTime = 0;
+		info->procAborted = FALSE;
+		info->frameHash = RING_IO_HASH_INIT;
+		info->repeatFrame = FALSE;
+
+		totalRcvbytes = TSKRING_IO_readFrame(info, Buffer, readerAcqSize,
+				packSize, exitFlag);
+		packSize = 0;
+		exitFlag = FALSE;
+
+		///////////////////////////////////////////////////////////////////////////////
+		//End  the read  task
+		///////////////////////////////////////////////////////////////////////////////
+
+
+		///////////////////////////////////////////////////////////////////////////////
+		//To do the algorithms with the Buffer (RING_IO_dataBufSize3)
+		///////////////////////////////////////////////////////////////////////////////
+		if ((!info->dropFrame) && (!info->passFrame) && (!info->exitflag)) {
+			size = (totalRcvbytes < readerAcqSize) ? totalRcvbytes
+					: readerAcqSize;
+			if (TSKRING_IO_repeatHit(info, Buffer, size) == FALSE) {
+				TSKRING_IO_runStages(info, Buffer, size);
+				TSKRING_IO_repeatSave(info, Buffer, size);
+			}
+		}
+
+
+		///////////////////////////////////////////////////////////////////////////////
+		//END To do the algorithms with the Buffer (RING_IO_dataBufSize3)
+		///////////////////////////////////////////////////////////////////////////////
+
+
+		///////////////////////////////////////////////////////////////////////////////
+		//start  the write  task
+		///////////////////////////////////////////////////////////////////////////////
+
+
+		if (RINGIO_SUCCESS == wrRingStatus) {
+			wrRingStatus = TSKRING_IO_writeFrame(info, Buffer, totalRcvbytes,
+					readerAcqSize);
+		}
+		totalRcvbytes = 0;
+
+		TSKRING_IO_frameDone(info);
+	}
+
+	status = MEM_free(DSPLINK_SEGID, Buffer, RING_IO_dataBufSize4);
+	if (info->repeatBuf != NULL) {
+		MEM_free(DSPLINK_SEGID, info->repeatBuf, 2u * RING_IO_dataBufSize4);
+		info->repeatBuf = NULL;
+	}
+
+	return (status);
+}
+
+/** ============================================================================
+ *  @func   TSKRING_IO_addStage
+ *
+ *  @desc   Appends a processing stage to a channel. Stages run in the order
+ *          they were added.
+ *
+ *  @modif  info->stages, info->numStages
+ *  ============================================================================
+ */
+Int TSKRING_IO_addStage(TSKRING_IO_TransferInfo * info,
+		TSKRING_IO_StageFxn fxn, TSKRING_IO_StageFxn fallbackFxn) {
+	Int status = SYS_OK;
+
+	if ((fxn == NULL) || (info->numStages >= TSKRING_IO_MAX_STAGES)) {
+		status = SYS_EINVAL;
+		SET_FAILURE_REASON(status);
+	} else {
+		info->stages[info->numStages].fxn = fxn;
+		info->stages[info->numStages].fallbackFxn = fallbackFxn;
+		info->numStages++;
 	}
 
 	return (status);
 }
 
 /** ============================================================================
- *  @func   TSKRING_IO_execute
+ *  @func   TSKRING_IO_delete
  *
- *  @desc   Execute phase function for the RingIO sample application. Application
- *          receives the data from the input RingIO and  processes data
- *          as specified by the attributes from GPP.Sends the same data
- *          back on output RingIO .
+ *  @desc   Delete phase function for the application. It deallocates
+ *          all the resources  allocated during create phase of the
+ *          application.
  *
  *  @modif  None.
  *  ============================================================================
  */
-Int TSKRING_IO_execute1(TSKRING_IO_TransferInfo * info) {
+Int TSKRING_IO_delete1(TSKRING_IO_TransferInfo * info) {
 	Int status = SYS_OK;
-	Int wrRingStatus = RINGIO_SUCCESS;
-	Int rdRingStatus = RINGIO_SUCCESS;
-	Bool semStatus = TRUE;
-	Bool exitFlag = FALSE;
-	Uint32 i;
-	Uint32 j;
-	Uint16 type;
-	Uint32 param;
-	Uint32 writerWaterMark;
-	Uint32 writeAcqSize;
-	Uint32 readerAcqSize;
-	Uint32 size;
-	Uint32 totalRcvbytes = 0;
-	Char * Buffer;
-	Uint32 bytesTransfered = 0;
-	Uint8 * ptr8;
-
-	RING_IO_dataBufSize3 = 1024;   // the DSP reader size
+	Int tmpStatus = SYS_OK;
+	Bool freeStatus = FALSE;
+	Uint32 size = 0;
 
 	/*
-	 *  Set the notification for Writer.
+	 *  Close the RingIO to be used with DSP as the writer.
 	 */
-	//writerWaterMark
-	//		= (RING_IO_dataBufSize1 < RINGIO_WRITE_ACQ_SIZE) ? RING_IO_dataBufSize1
-	//				: RINGIO_WRITE_ACQ_SIZE;
-	//writerWaterMark = RING_IO_dataBufSize1;
-	writerWaterMark = RINGIO_WRITE_ACQ_SIZE;
+	if (info->writerHandle != NULL) {
+		do {
+			size = RingIO_getValidAttrSize(info->writerHandle);
+		} while (size != 0);
+
+		/* Ensure that gpp has read all the data */
+		tmpStatus = RingIO_close(info->writerHandle);
+		if (tmpStatus != SYS_OK) {
+			status = tmpStatus;
+			SET_FAILURE_REASON(status);
+		} else {
+			info->writerHandle = NULL;
+		}
+	}
 
+	/*
+	 *  Delete the RingIO to be used with DSP as the writer.
+	 */
 	do {
-		status = RingIO_setNotifier(info->writerHandle,
-				RINGIO_NOTIFICATION_ONCE, writerWaterMark,
-				&TSKRING_IO_writer_notify, (RingIO_NotifyParam) info);
-	} while (status != SYS_OK);
+#if defined (DSPLINK_LEGACY_SUPPORT)
+		tmpStatus = RingIO_delete (info->writerName);
+#else
+		tmpStatus = RingIO_delete(GBL_getProcId(), info->writerName);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+		if (tmpStatus != SYS_OK) {
+		}
+	} while (tmpStatus != SYS_OK);
 
 	/*
-	 *  Set the notification for Reader.
+	 *  Close the RingIO to be used with DSP as the reader.
 	 */
-	// readerAcqSize = (RING_IO_dataBufSize3 < RINGIO_READ_ACQ_SIZE)?
-	//                 RING_IO_dataBufSize3 : RINGIO_READ_ACQ_SIZE ;
+	if (info->readerHandle != NULL) {
+		do {
+
+			status = RingIO_close(info->readerHandle);
+			if (status != SYS_OK) {
+				SET_FAILURE_REASON(status);
+			} else {
+				info->readerHandle = NULL;
+			}
+		} while (status != SYS_OK);
+	}
 
+	/* Stop the notification timer on this channel */
+	TSKRING_IO_channels[0] = NULL;
 
-	readerAcqSize = RING_IO_dataBufSize3;   //GPP size[0]
-	Buffer = MEM_calloc(DSPLINK_SEGID, readerAcqSize, DSPLINK_BUF_ALIGN);
-	if(NULL == Buffer) {
-		status = RINGIO_EFAILURE;
+	/* Drop the shared tables, they stay cached for a restart */
+	if (info->scaleTable != NULL) {
+		RING_IO_tablePut(info->scaleTable);
+		info->scaleTable = NULL;
+	}
+
+	/* Free the info structure */
+	freeStatus = MEM_free(DSPLINK_SEGID, info, sizeof(TSKRING_IO_TransferInfo));
+
+	if ((status == SYS_OK) && (freeStatus != TRUE)) {
+		status = SYS_EFREE;
 		SET_FAILURE_REASON(status);
 	}
 
-	do {
-		status = RingIO_setNotifier(info->readerHandle,
-				RINGIO_NOTIFICATION_ONCE, 0 /* readerWaterMark */,
-				&TSKRING_IO_reader_notify, (RingIO_NotifyParam) info);
-	} while (status != SYS_OK);
+	return (status);
+}
 
-	writeAcqSize = writerWaterMark;
+Int TSKRING_IO_delete2(TSKRING_IO_TransferInfo * info) {
+	Int status = SYS_OK;
+	Int tmpStatus = SYS_OK;
+	Bool freeStatus = FALSE;
+	Uint32 size = 0;
 
-	//while (1) {
-	while (!info->exitflag) {
+	/*
+	 *  Close the RingIO to be used with DSP as the writer.
+	 */
+	if (info->writerHandle != NULL) {
+		do {
+			size = RingIO_getValidAttrSize(info->writerHandle);
+		} while (size != 0);
 
-		/* Wait for the start notification from gpp */
-		semStatus = SEM_pend(&(info->readerSemObj), SYS_FOREVER);
-		if (semStatus == FALSE) {
-			status = RINGIO_EFAILURE;
+		/* Ensure that gpp has read all the data */
+		tmpStatus = RingIO_close(info->writerHandle);
+		if (tmpStatus != SYS_OK) {
+			status = tmpStatus;
 			SET_FAILURE_REASON(status);
 		} else {
-			status = SYS_OK;
+			info->writerHandle = NULL;
 		}
+	}
 
-		if ((info->freadStart == TRUE)&&(!info->exitflag)) {
+	/*
+	 *  Delete the RingIO to be used with DSP as the writer.
+	 */
+	do {
+#if defined (DSPLINK_LEGACY_SUPPORT)
+		tmpStatus = RingIO_delete (info->writerName);
+#else
+		tmpStatus = RingIO_delete(GBL_getProcId(), info->writerName);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+		if (tmpStatus != SYS_OK) {
+		}
+	} while (tmpStatus != SYS_OK);
 
-			info->freadStart = FALSE;
+	/*
+	 *  Close the RingIO to be used with DSP as the reader.
+	 */
+	if (info->readerHandle != NULL) {
+		do {
 
-			/* Got  data transfer start notification from DSP*/
-			do {
+			status = RingIO_close(info->readerHandle);
+			if (status != SYS_OK) {
+				SET_FAILURE_REASON(status);
+			} else {
+				info->readerHandle = NULL;
+			}
+		} while (status != SYS_OK);
+	}
 
-				/* Get the start attribute from dsp */
-				status = RingIO_getAttribute(info->readerHandle, &type, &param);
-				if ((status == RINGIO_SUCCESS) || (status
-						== RINGIO_SPENDINGATTRIBUTE)) {
+	/* Stop the notification timer on this channel */
+	TSKRING_IO_channels[1] = NULL;
 
-					if (type == (Uint16) RINGIO_DATA_START) {
-						/*RING_IO_0Print ("GPP<--DSP1:Received Data Transfer"
-						 "Start Attribute\n") ;*/
-						break;
-					}
+	/* Drop the shared tables, they stay cached for a restart */
+	if (info->scaleTable != NULL) {
+		RING_IO_tablePut(info->scaleTable);
+		info->scaleTable = NULL;
+	}
 
-				}
+	/* Free the info structure */
+	freeStatus = MEM_free(DSPLINK_SEGID, info, sizeof(TSKRING_IO_TransferInfo));
 
-			} while ((status != RINGIO_SUCCESS) && (status
-					!= RINGIO_SPENDINGATTRIBUTE) &&(!info->exitflag));
-		}
+	if ((status == SYS_OK) && (freeStatus != TRUE)) {
+		status = SYS_EFREE;
+		SET_FAILURE_REASON(status);
+	}
 
-		info->readerRecvSize = readerAcqSize; //the size of RingIO_acquire
-		info->scaleSize = readerAcqSize; //the size of the rest of the RingIO_acquire
-		while ((exitFlag == FALSE) && (!info->exitflag)) {
-			rdRingStatus = RingIO_acquire(info->readerHandle,
-					(RingIO_BufPtr *) &(info->readerBuf),
-					&(info->readerRecvSize));
+	return (status);
+}
 
-			if ((rdRingStatus == RINGIO_EFAILURE) || (rdRingStatus
-					== RINGIO_EBUFEMPTY)) {
-				/* Wait for the read buffer to be available */
-				semStatus = SEM_pend(&(info->readerSemObj), SYS_FOREVER);
-				if (semStatus == FALSE) {
-					status = RINGIO_EFAILURE;
-					SET_FAILURE_REASON(status);
-				} else {
-					status = SYS_OK;
-				}
-			} else if ((rdRingStatus == RINGIO_SUCCESS)
-					|| ((info->readerRecvSize > 0) && ((rdRingStatus
-							== RINGIO_ENOTCONTIGUOUSDATA) || (rdRingStatus
-							== RINGIO_EBUFWRAP) || (rdRingStatus
-							== RINGIO_SPENDINGATTRIBUTE)))) {
-				/* Acquired Read buffer.Copy input received data
-				 *to output buffer and  process the buffer as
-				 *specified in the received  variable attribute
-				 */
-				info->scaleSize -= info->readerRecvSize;
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_reader_notify
+ *
+ *  @desc   This function implements the notification callback for the RingIO1
+ *          opened by the DSP in  reader mode.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_reader_notify(RingIO_Handle handle,
+		RingIO_NotifyParam param, RingIO_NotifyMsg msg) {
+	TSKRING_IO_TransferInfo * info;
+	(Void) handle; /* To avoid compiler warning */
+	(Void) msg; /* To avoid compiler warning */
 
-				if (Buffer && info->readerBuf) {
-					if ((totalRcvbytes + info->readerRecvSize) <= readerAcqSize)
-					//if ((totalRcvbytes + info->readerRecvSize) < readerAcqSize)
-						memcpy((Buffer + totalRcvbytes), info->readerBuf,
-								info->readerRecvSize);
-				}
-				totalRcvbytes += info->readerRecvSize;
+	if (param != NULL) {
+		info = (TSKRING_IO_TransferInfo *) param;
 
-				/* Release the input buffer(reader buffer) */
-				rdRingStatus = RingIO_release(info->readerHandle,
-						info->readerRecvSize);
-				if (RINGIO_SUCCESS != rdRingStatus) {
-					SET_FAILURE_REASON(rdRingStatus);
+		/* Queue the notification for the task, in order */
+		TSKRING_IO_eventPut(info, msg);
 
-				}
-				/* Set the acqSize for the next acquire */
-				if (info->scaleSize == 0) {
-					/* Reset  the rcvSize to  size of the full buffer  */
-					info->scaleSize = RING_IO_dataBufSize3;
-					info->readerRecvSize = RING_IO_dataBufSize3;
-				} else {
-					/*Acquire the partial buffer  in next acquire */
-					info->readerRecvSize = info->scaleSize;
-				}
+		/* Post the semaphore. */
+		SEM_post((SEM_Handle) & (info->readerSemObj));
+	}
+}
 
-			}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_writer_notify
+ *
+ *  @desc   This function implements the notification callback for the RingIO2
+ *          opened by the DSP in writer  mode.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_writer_notify(RingIO_Handle handle,
+		RingIO_NotifyParam param, RingIO_NotifyMsg msg) {
+	TSKRING_IO_TransferInfo * info;
+	(Void) handle; /* To avoid compiler warning */
+	(Void) msg; /* To avoid compiler warning */
+
+	if (param != NULL) {
+		info = (TSKRING_IO_TransferInfo *) param;
+		/* Post the semaphore. */
+		SEM_post((SEM_Handle) & (info->writerSemObj));
+	}
+}
 
-			else if (rdRingStatus == RINGIO_SPENDINGATTRIBUTE) {
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_shedCheck
+ *
+ *  @desc   Runs the overload detector at the start of a frame and applies the
+ *          channel load shedding policy to the frame.
+ *          Frames are late after shedMissLimit consecutive deadline misses,
+ *          or when the input backlog, in frames of the last size, takes more
+ *          than the deadline to drain at the current frame period. The
+ *          channel becomes overloaded when its frames are late and the input
+ *          RingIO is filled to shedFillMark percent, and stays overloaded
+ *          until the fill is back to shedLowMark percent.
+ *
+ *  @modif  info
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_shedCheck(TSKRING_IO_TransferInfo * info) {
+	Bool overloaded = FALSE;
+	Bool late = FALSE;
+	Uint32 validSize;
+	Uint32 totalSize;
+	Uint32 now;
+
+	info->dropFrame = FALSE;
+	info->passFrame = FALSE;
+
+	now = CLK_gethtime();
+	if (info->frameStart != 0) {
+		info->framePeriod = now - info->frameStart;
+	}
+	info->frameStart = now;
 
-				rdRingStatus = RingIO_getAttribute(info->readerHandle, &type,
-						&param);
-				if ((RINGIO_SUCCESS == rdRingStatus)
-						|| (RINGIO_SPENDINGATTRIBUTE == rdRingStatus)) {
+	validSize = RingIO_getValidSize(info->readerHandle);
+	totalSize = validSize + RingIO_getEmptySize(info->readerHandle);
+	info->fillLevel = (totalSize != 0) ? ((validSize * 100u) / totalSize) : 0;
 
-					/* Got the fixed attribute */
-					if (type == RINGIO_DATA_END) {
-						/* End of data transfer from DSP */
+	if ((info->shedPolicy != SHED_POLICY_NONE) && (info->shedDeadline != 0)) {
+		if ((info->shedMissLimit != 0)
+				&& (info->shedMissCount >= info->shedMissLimit)) {
+			late = TRUE;
+		}
 
-						exitFlag = TRUE;
-					}
-				} else if (rdRingStatus == RINGIO_EVARIABLEATTRIBUTE) {
-					j = sizeof(attrs);
-					rdRingStatus = RingIO_getvAttribute(info->readerHandle,
-							&type, &i, attrs, &j);
-					if ((RINGIO_SUCCESS == rdRingStatus)
-							|| (RINGIO_SPENDINGATTRIBUTE == rdRingStatus)) {
-
-						/* got the variable attribute */
-						//readerAcqSize = attrs[0];
-
-						//info->scaleSize = attrs[0];
-						info->scaleSize = attrs[0];
-						info->readerRecvSize = info->scaleSize;
-					} else if (RINGIO_EVARIABLEATTRIBUTE == rdRingStatus) {
-
-						/* This case should not arise.
-						 * as we have provided the sufficient buffer
-						 * to receive variable Attribute
-						 */
-						SET_FAILURE_REASON(rdRingStatus);
-					} else {
-						/* For RINGIO_EPENDINGDATA, RINGIO_EFAILURE
-						 * nothing to be done. go and  read data again
-						 */
-					}
-				} else {
-					/* For other return status
-					 * (RINGIO_EPENDINGDATA,RINGIO_EFAILURE)
-					 * no thing o be done. go and read the data again
-					 */
+		/* Backlog latency, compared without the product overflowing */
+		if ((info->frameBytes != 0) && (info->framePeriod != 0)
+				&& ((validSize / info->frameBytes)
+						> (info->shedDeadline / info->framePeriod))) {
+			late = TRUE;
+		}
 
-				}
-			} else {
-				/* For Any other  wrRingStatus,Consider it as failure */
-				status = RINGIO_EFAILURE;
-				SET_FAILURE_REASON(status);
-			}
-			/* Reset the acquired size if it is changed to zero by the
-			 * failed acquire call
+		if (info->overloaded == TRUE) {
+			/* Shed the backlog down to the low mark, not just below the
+			 * high one
 			 */
-			if (info->readerRecvSize == 0) {
-				info->readerRecvSize = info->scaleSize;
-			}
+			overloaded = (info->shedFillMark != 0) ?
+					(info->fillLevel > info->shedLowMark) : late;
+		} else {
+			overloaded = (late == TRUE) && ((info->shedFillMark == 0)
+					|| (info->fillLevel >= info->shedFillMark));
+		}
 
+		if ((overloaded == TRUE) && (info->overloaded == FALSE)) {
+			info->stats.overloadEvents++;
+			info->shedCount = 0;
 		}
+		info->overloaded = overloaded;
 
-		//totalRcvbytes = 0;
-		info->readerRecvSize = readerAcqSize; //the size of RingIO_acquire
-		info->scaleSize = readerAcqSize; //the size of the rest of the RingIO_acquire
-		info->freadEnd = FALSE;
-		exitFlag = FALSE;
+		if (overloaded == TRUE) {
+			info->shedCount++;
 
-		///////////////////////////////////////////////////////////////////////////////
-		//End  the read  task
-		///////////////////////////////////////////////////////////////////////////////
+			switch (info->shedPolicy) {
+			case SHED_POLICY_DROP_OLDEST:
+				/* The frame at the head of the input RingIO is the oldest,
+				 * dropped until the backlog is down to the low mark
+				 */
+				info->dropFrame = TRUE;
+				break;
 
+			case SHED_POLICY_DROP_NTH:
+				if ((info->shedNth != 0)
+						&& ((info->shedCount % info->shedNth) == 0)) {
+					info->dropFrame = TRUE;
+				}
+				break;
 
+			case SHED_POLICY_PASSTHROUGH:
+				info->passFrame = TRUE;
+				break;
 
-				//debug
-						
-							do {
-								wrRingStatus = RingIO_sendNotify(info->writerHandle,
-										(RingIO_NotifyMsg)(totalRcvbytes) );
-								if (wrRingStatus != RINGIO_SUCCESS) {
-									SET_FAILURE_REASON(wrRingStatus);
-								}
-							} while (wrRingStatus != RINGIO_SUCCESS);
-						
+			default:
+				break;
+			}
+		}
+	}
+}
 
-				//debug
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_markFrame
+ *
+ *  @desc   Sets the shed/pass-through attribute on the output RingIO for a
+ *          frame selected by the load shedding policy.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_markFrame(TSKRING_IO_TransferInfo * info, Uint32 size) {
+	Int status = RINGIO_SUCCESS;
+	Uint16 type;
 
+	if ((info->dropFrame == TRUE) || (info->passFrame == TRUE)
+			|| (info->repeatFrame == TRUE)) {
+		if (info->dropFrame == TRUE) {
+			type = (Uint16) RINGIO_DATA_SHED;
+		} else if (info->passFrame == TRUE) {
+			type = (Uint16) RINGIO_DATA_PASS;
+		} else {
+			type = (Uint16) RINGIO_DATA_REPEAT;
+		}
+		if (info->packAttrs == TRUE) {
+			TSKRING_IO_packPut(info, type, size);
+		} else {
+			status = RingIO_setAttribute(info->writerHandle, 0, type, size);
+			if (status != RINGIO_SUCCESS) {
+				SET_FAILURE_REASON(status);
+			}
+		}
+	}
 
+	return (status);
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_frameDone
+ *
+ *  @desc   Updates the channel counters and the deadline miss run at the end
+ *          of a frame.
+ *
+ *  @modif  info
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_frameDone(TSKRING_IO_TransferInfo * info) {
+	Uint32 elapsed;
+
+	info->stats.framesIn++;
+	if (info->dropFrame == TRUE) {
+		info->stats.framesShed++;
+	} else {
+		info->stats.framesOut++;
+		if (info->passFrame == TRUE) {
+			info->stats.framesPassed++;
+		}
+	}
 
+	if (info->shedDeadline != 0) {
+		elapsed = CLK_gethtime() - info->frameStart;
+		if (elapsed > info->shedDeadline) {
+			info->stats.deadlineMisses++;
+			info->shedMissCount++;
+		} else {
+			info->shedMissCount = 0;
+		}
+	}
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_degradeCheck
+ *
+ *  @desc   Switches the channel between the full and fallback stage variants
+ *          at a frame boundary. The channel degrades when the stage load or
+ *          the input RingIO fill crosses its high threshold, and recovers only
+ *          once both are back under their low threshold.
+ *
+ *  @modif  info->degraded
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_degradeCheck(TSKRING_IO_TransferInfo * info) {
+	Uint32 load = 0;
 
+	if (info->framePeriod != 0) {
+		load = (info->stageTime * 100u) / info->framePeriod;
+	}
 
+	if (info->degraded == FALSE) {
+		if ((load >= info->degradeLoadHi)
+				|| (info->fillLevel >= info->degradeFillHi)) {
+			info->degraded = TRUE;
+			info->stats.qualitySwitches++;
+		}
+	} else {
+		if ((load <= info->degradeLoadLo)
+				&& (info->fillLevel <= info->degradeFillLo)) {
+			info->degraded = FALSE;
+			info->stats.qualitySwitches++;
+		}
+	}
+}
 
-		///////////////////////////////////////////////////////////////////////////////
-		//To do the algorithms with the Buffer (RING_IO_dataBufSize3)
-		///////////////////////////////////////////////////////////////////////////////
-		//if(&& (!info->exitflag))
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_runStages
+ *
+ *  @desc   Finishes the channel processing stages over the frame buffer and
+ *          accounts the frame against the budget. Blocks already processed
+ *          while the input was being copied are not run again.
+ *
+ *  @modif  buffer, info->stageTime
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_runStages(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size) {
+	Int status;
 
+	status = TSKRING_IO_runBlocks(info, buffer, size, TRUE);
+	info->stageTime = info->procTime;
+	TSKRING_IO_budgetCheck(info, info->stageTime);
 
-		///////////////////////////////////////////////////////////////////////////////
-		//END To do the algorithms with the Buffer (RING_IO_dataBufSize3)
-		///////////////////////////////////////////////////////////////////////////////
+	return (status);
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_runBlocks
+ *
+ *  @desc   Runs the channel processing stages from info->procOffset up to
+ *          end, using the fallback variant of each stage while the channel
+ *          is degraded. Each RING_IO_STAGE_BLOCKSIZE block goes through all
+ *          stages while it is still in cache. When budgetAbort is set,
+ *          processing stops at the first block boundary past the budget,
+ *          counting the time of the earlier calls for the frame.
+ *          In the RING_IO_FIXED_CONFIG build, full frames not yet started go
+ *          through the compile-time stage list RING_IO_FIXED_STAGES instead,
+ *          with constant block counts and no per-stage dispatch, unless the
+ *          channel is degraded.
+ *
+ *  @modif  buffer, info->procOffset, info->procTime, info->procAborted
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_runBlocks(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 end, Bool final) {
+	Int status = SYS_OK;
+	Uint32 now;
+	Uint32 start;
+	Uint32 stageStart;
+	Uint32 offset;
+	Uint32 block;
+	Uint32 i;
+	TSKRING_IO_StageFxn fxn;
 
-		///////////////////////////////////////////////////////////////////////////////
-		//start  the write  task
-		///////////////////////////////////////////////////////////////////////////////
+	if (info->procAborted == TRUE) {
+		return (status);
+	}
 
-		if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
-			type = (Uint16) RINGIO_DATA_START;
-			/* Set the attribute start attribute to output */
-			wrRingStatus = RingIO_setAttribute(info->writerHandle, 0, type, 0);
-			if (wrRingStatus != RINGIO_SUCCESS) {
-				SET_FAILURE_REASON(wrRingStatus);
-			} else {
-				/* Sending the Hard Notification to gpp reader */
-				do {
-					wrRingStatus = RingIO_sendNotify(info->writerHandle,
-							(RingIO_NotifyMsg) NOTIFY_DATA_START);
-					if (wrRingStatus != RINGIO_SUCCESS) {
-						SET_FAILURE_REASON(wrRingStatus);
-					}
-				} while ((wrRingStatus != RINGIO_SUCCESS) && (!info->exitflag));
+	now = CLK_gethtime();
+	/* The budget runs from the first block of the frame */
+	start = now - info->procTime;
+	offset = info->procOffset;
+#if defined (RING_IO_FIXED_CONFIG)
+	if ((final == TRUE) && (offset == 0) && (end == RING_IO_FIXED_FRAMESIZE)
+			&& (info->degraded == FALSE) && (info->stageClock == NULL)) {
+		for (offset = 0; offset < RING_IO_FIXED_FRAMESIZE;
+				offset += RING_IO_STAGE_BLOCKSIZE) {
+			RING_IO_FIXED_STAGES(buffer + offset);
+
+			if (((offset + RING_IO_STAGE_BLOCKSIZE) < RING_IO_FIXED_FRAMESIZE)
+					&& (TSKRING_IO_overBudget(info, start) == TRUE)) {
+				/* Leave the rest of the frame unprocessed */
+				info->procAborted = TRUE;
+				info->stats.framesAborted++;
+				break;
 			}
 		}
+	} else
+#endif /* if defined (RING_IO_FIXED_CONFIG) */
+	{
+		while ((offset < end) && (status == SYS_OK)) {
+			block = end - offset;
+			if (block > RING_IO_STAGE_BLOCKSIZE) {
+				block = RING_IO_STAGE_BLOCKSIZE;
+			} else if ((block < RING_IO_STAGE_BLOCKSIZE) && (final == FALSE)) {
+				/* Wait for the rest of the block */
+				break;
+			}
 
-		if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
-			//	while ((RING_IO_dataBufSize1 == 0) || (bytesTransfered
-			while ((bytesTransfered < totalRcvbytes) && (!info->exitflag) ) {
-				/* Update the attrs to send variable attribute to DSP*/
-				attrs[0] = RINGIO_WRITE_ACQ_SIZE;
-				wrRingStatus = RingIO_setvAttribute(info->writerHandle, 0, 0,
-						0, attrs, sizeof(attrs));
-
-				if (wrRingStatus == RINGIO_EWRONGSTATE) {
+			for (i = 0; (i < info->numStages) && (status == SYS_OK); i++) {
+				fxn = info->stages[i].fxn;
+				if ((info->degraded == TRUE)
+						&& (info->stages[i].fallbackFxn != NULL)) {
+					fxn = info->stages[i].fallbackFxn;
+				}
+				if (info->stageClock != NULL) {
+					stageStart = CLK_gethtime();
+					status = (*fxn)(info, buffer + offset, block);
+					info->stageClock[i] += CLK_gethtime() - stageStart;
 				} else {
-					/* Acquire writer bufs and initialize and release them. */
-					info->writerRecvSize = RINGIO_WRITE_ACQ_SIZE;
-					wrRingStatus = RingIO_acquire(info->writerHandle,
-							(RingIO_BufPtr *) &(info->writerBuf),
-							&(info->writerRecvSize));
-
-					if ((wrRingStatus == RINGIO_EFAILURE) || (wrRingStatus
-							== RINGIO_EBUFFULL)) {
-						/* Wait for Writer notification */
-						semStatus
-								= SEM_pend(&(info->writerSemObj), SYS_FOREVER);
-						if (semStatus == FALSE) {
-							status = RINGIO_EFAILURE;
-							SET_FAILURE_REASON(status);
-						} else {
-							status = SYS_OK;
-						}
-					} else if (wrRingStatus == RINGIO_SUCCESS) {
+					status = (*fxn)(info, buffer + offset, block);
+				}
+			}
+			offset += block;
+			if (final == FALSE) {
+				info->stats.blocksOverlapped++;
+			}
 
-						/* Successfully acquired the output buffer of size equal to
-						 * writeAcqSize
-						 */
-						//Initial the write buffer
-						ptr8 = (Uint8 *) (info->writerBuf);
-						if (info->writerBuf != NULL) {
-							for (i = 0; ((i < info->writerRecvSize) && ((i + bytesTransfered) < totalRcvbytes)); i++) {
+			if (((offset < end) || (final == FALSE))
+					&& (TSKRING_IO_overBudget(info, start) == TRUE)) {
+				/* Leave the rest of the frame unprocessed */
+				info->procAborted = TRUE;
+				info->stats.framesAborted++;
+				break;
+			}
+		}
+	}
+	info->procOffset = offset;
+	info->procTime += CLK_gethtime() - now;
 
-								*ptr8 = Buffer[(i + bytesTransfered)] ;
-								//*ptr8 = 10;
-								ptr8++;
+	return (status);
+}
 
-							}
-						}
-						if (((bytesTransfered
-								+ info->writerRecvSize) > totalRcvbytes)) {
-
-							/* we have acquired more buffer than the rest of data
-							 * bytes to be transferred */
-							if (bytesTransfered != totalRcvbytes) {
-
-								wrRingStatus
-										= RingIO_release(info->writerHandle,
-												(totalRcvbytes
-														- bytesTransfered));
-								if (RINGIO_SUCCESS != wrRingStatus) {
-									SET_FAILURE_REASON(wrRingStatus);
-								}
-							}
-
-							/* Cancel the  rest of the buffer */
-							wrRingStatus = RingIO_cancel(info->writerHandle);
-							if (RINGIO_SUCCESS != wrRingStatus) {
-								SET_FAILURE_REASON(wrRingStatus);
-							}
-							bytesTransfered = totalRcvbytes;
-
-						} else {
-							wrRingStatus = RingIO_release(info->writerHandle,
-									info->writerRecvSize);
-							if (RINGIO_SUCCESS != wrRingStatus) {
-								SET_FAILURE_REASON(wrRingStatus);
-							} else {
-								bytesTransfered += info->writerRecvSize;
-							}
-						}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_overBudget
+ *
+ *  @desc   Tells whether processing of the current frame should be cut short
+ *          because it has used up the channel budget.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Bool TSKRING_IO_overBudget(TSKRING_IO_TransferInfo * info, Uint32 start) {
+	return ((info->budgetAbort == TRUE) && (info->budgetHtime != 0)
+			&& ((CLK_gethtime() - start) > info->budgetHtime));
+}
 
-					}
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_budgetCheck
+ *
+ *  @desc   Accounts the processing cycles of a frame against the channel
+ *          budget and records any overrun in the histogram.
+ *
+ *  @modif  info->stats
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_budgetCheck(TSKRING_IO_TransferInfo * info,
+		Uint32 elapsed) {
+	Uint32 cycles;
+	Uint32 over;
+	Uint32 bin;
+
+	cycles = (Uint32) ((Float) elapsed * info->cyclesPerHtime);
+	info->stats.cyclesLast = cycles;
+	if (cycles > info->stats.cyclesMax) {
+		info->stats.cyclesMax = cycles;
+	}
 
-				}
-			}
+	if ((info->budget != 0) && (cycles > info->budget)) {
+		/* Overrun in quarters of the budget */
+		over = ((cycles - info->budget) * 4u) / info->budget;
+		if (over < 1u) {
+			bin = 0;
+		} else if (over < 2u) {
+			bin = 1;
+		} else if (over < 4u) {
+			bin = 2;
+		} else if (over < 8u) {
+			bin = 3;
+		} else {
+			bin = 4;
+		}
+		info->stats.overrunHist[bin]++;
+	}
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_scaleStage
+ *
+ *  @desc   Processing stage applying the scaling factor and operation
+ *          received from the GPP.
+ *
+ *  @modif  buffer
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_scaleStage(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size) {
+	if (!TSKRING_IO_SCALE_ACTIVE(info)) {
+		/* No operation configured, leave the samples alone */
+		return (SYS_OK);
+	}
 
+#if (DSP_MAUSIZE == 1)
+	if (info->scaleTable != NULL) {
+		RING_IO_scaleLookup((RING_IO_Mau *) buffer, RING_IO_MAUS(size),
+				(const Uint8 *) info->scaleTable);
+	} else
+#endif /* if (DSP_MAUSIZE == 1) */
+	{
+		RING_IO_apply((RingIO_BufPtr *) buffer, info->scalingFactor,
+				info->scaleOpCode, size);
+	}
 
+	return (SYS_OK);
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_scaleFastStage
+ *
+ *  @desc   Fallback processing stage scaling by a power of two.
+ *
+ *  @modif  buffer
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_scaleFastStage(TSKRING_IO_TransferInfo * info,
+		Char * buffer, Uint32 size) {
+	if (TSKRING_IO_SCALE_ACTIVE(info)) {
+		RING_IO_scaleShift((RING_IO_Mau *) buffer, RING_IO_MAUS(size),
+				info->scaleOpCode, info->scaleShift);
+	}
 
-				//debug
-						
-							do {
-								wrRingStatus = RingIO_sendNotify(info->writerHandle,
-										(RingIO_NotifyMsg)(bytesTransfered) );
-								if (wrRingStatus != RINGIO_SUCCESS) {
-									SET_FAILURE_REASON(wrRingStatus);
-								}
-							} while (wrRingStatus != RINGIO_SUCCESS);
-						
+	return (SYS_OK);
+}
 
-				//debug
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_scaleTable
+ *
+ *  @desc   Looks up the shared scale lookup table of the channel's
+ *          operation and factor. Channels with the same parameters share
+ *          one table, which stays cached across channel restarts.
+ *
+ *  @modif  info->scaleTable, info->scaleShift
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_scaleTable(TSKRING_IO_TransferInfo * info) {
+	info->scaleShift = RING_IO_scaleLog2(info->scalingFactor);
 
+	if (info->scaleTable != NULL) {
+		RING_IO_tablePut(info->scaleTable);
+		info->scaleTable = NULL;
+	}
 
+#if (DSP_MAUSIZE == 1)
+	if (TSKRING_IO_SCALE_ACTIVE(info)) {
+		/* Without a table the stage computes the samples */
+		RING_IO_tableGet(RING_IO_TABLE_SCALE, info->scaleOpCode,
+				info->scalingFactor, RING_IO_SCALE_TABLESIZE,
+				&RING_IO_scaleTableBuild, &info->scaleTable);
+	}
+#endif /* if (DSP_MAUSIZE == 1) */
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_jitterWait
+ *
+ *  @desc   Jitter buffer. Delays consumption of the frame that has just
+ *          started on the input RingIO until its release slot.
+ *          Release slots follow the frame period, which is taken from the GPP
+ *          timestamps when present and learnt from the arrival times
+ *          otherwise. The arrival jitter is estimated as in RFC 3550 and the
+ *          target delay follows it between jitterMinDelay and jitterMaxDelay.
+ *          Frames arriving after their slot are released at once and counted
+ *          late. Frames that would be held longer than jitterMaxDelay are
+ *          counted early and the schedule is re-anchored on them.
+ *
+ *  @modif  info
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_jitterWait(TSKRING_IO_TransferInfo * info, Uint32 stamp) {
+	Uint32 arrival;
+	Uint32 interArrival;
+	Uint32 expected;
+	Uint32 release;
+	Uint32 ticks;
+	Int32 delta;
+
+	if (info->jitterMinDelay != 0) {
+		arrival = info->arrivalTime;
+		if (arrival == 0) {
+			arrival = CLK_gethtime();
+		}
+		info->arrivalTime = 0;
 
+		if (info->lastArrival == 0) {
+			/* First frame anchors the schedule */
+			release = arrival + info->jitterDelay;
+		} else {
+			interArrival = arrival - info->lastArrival;
+			if ((stamp != 0) && (info->lastStamp != 0)) {
+				expected = TSKRING_IO_usToHtime(stamp - info->lastStamp);
+				info->jitterPeriod = expected;
+			} else {
+				if (info->jitterPeriod == 0) {
+					info->jitterPeriod = interArrival;
+				}
+				expected = info->jitterPeriod;
+				info->jitterPeriod += ((Int32) (interArrival - expected)) / 16;
+			}
 
+			/* Interarrival jitter estimate, J += (|D| - J) / 16 */
+			delta = (Int32) (interArrival - expected);
+			if (delta < 0) {
+				delta = -delta;
+			}
+			info->jitter += ((Int32) ((Uint32) delta - info->jitter)) / 16;
 
+			/* Target delay follows the jitter within its bounds */
+			info->jitterDelay = 3u * info->jitter;
+			if (info->jitterDelay < info->jitterMinDelay) {
+				info->jitterDelay = info->jitterMinDelay;
+			}
+			if (info->jitterDelay > info->jitterMaxDelay) {
+				info->jitterDelay = info->jitterMaxDelay;
+			}
 
-			bytesTransfered = 0;
-			totalRcvbytes = 0;
-			if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
+			/* Next slot on the cadence, drifting toward the target delay */
+			release = info->lastRelease + expected;
+			release += ((Int32) ((arrival + info->jitterDelay) - release)) / 16;
 
-				/* Send  End of  data transfer attribute to DSP */
-				type = (Uint16) RINGIO_DATA_END;
-				do {
-					wrRingStatus = RingIO_setAttribute(info->writerHandle, 0, type,
-							0);
-					if (wrRingStatus != RINGIO_SUCCESS) {
-						SET_FAILURE_REASON(wrRingStatus);
-					} else {
-						status = RINGIO_SUCCESS;
-						
-					}
-				} while ((RINGIO_SUCCESS != wrRingStatus) && (!info->exitflag));
+			if ((Int32) (release - arrival) < 0) {
+				info->stats.framesLate++;
+				release = arrival;
+			} else if ((release - arrival) > info->jitterMaxDelay) {
+				info->stats.framesEarly++;
+				release = arrival + info->jitterDelay;
 			}
-			if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
+		}
 
-				/* Send Notification  to  the reader (DSP)
-				 * This allows DSP  application to come out from blocked state  if
-				 * it is waiting for Data buffer and  GPP sent only data end
-				 * attribute.
-				 */
-				wrRingStatus = RingIO_sendNotify(info->writerHandle,
-						(RingIO_NotifyMsg) NOTIFY_DATA_END);
-				if (wrRingStatus != RINGIO_SUCCESS) {
-					SET_FAILURE_REASON(wrRingStatus);
-				} else {
-					status = RINGIO_SUCCESS;
-					TSK_yield();
-					
-				}
+		info->lastArrival = arrival;
+		info->lastStamp = stamp;
+		info->lastRelease = release;
+
+		delta = (Int32) (release - CLK_gethtime());
+		if (delta > 0) {
+			ticks = (Uint32) delta / CLK_getprd();
+			if (ticks != 0) {
+				TSK_sleep(ticks);
 			}
 		}
 	}
-	status = MEM_free(DSPLINK_SEGID, Buffer, RING_IO_dataBufSize3);
-	
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_usToHtime
+ *
+ *  @desc   Converts microseconds to CLK_gethtime() counts without overflowing
+ *          for intervals up to several seconds.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_usToHtime(Uint32 usec) {
+	Uint32 countsPerMs = CLK_countspms();
 
-	return (status);
+	return (((usec / 1000u) * countsPerMs)
+			+ (((usec % 1000u) * countsPerMs) / 1000u));
 }
 
-Int TSKRING_IO_execute2(TSKRING_IO_TransferInfo * info) {
-	Int status = SYS_OK;
-	Int wrRingStatus = RINGIO_SUCCESS;
-	Int rdRingStatus = RINGIO_SUCCESS;
-	Bool semStatus = TRUE;
-	Bool exitFlag = FALSE;
-	Uint32 i;
-	Uint32 j;
-	Uint16 type;
-	Uint32 param;
-	Uint32 writerWaterMark;
-	Uint32 writeAcqSize;
-	Uint32 readerAcqSize;
-	Uint32 size;
-	Uint32 totalRcvbytes = 0;
-	Char * Buffer;
-	Uint32 bytesTransfered = 0;
-	Uint8 * ptr8;
-
-	RING_IO_dataBufSize4 = 2048;  //The DSP reader Size
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_writeSize
+ *
+ *  @desc   Computes the size of the next writer acquire.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_writeSize(TSKRING_IO_TransferInfo * info,
+		Uint32 remaining) {
+	Uint32 size = RINGIO_WRITE_ACQ_SIZE;
+	Uint32 empty;
+
+	if (remaining < size) {
+		/* A full acquire would need a partial release and a cancel */
+		size = remaining;
+	}
 
-	/*
-	 *  Set the notification for Writer.
+	/* Stay within the free space rather than blocking on EBUFFULL. When the
+	 * ring is full the acquire fails and the writer waits for the notifier.
+	 * A flexible writer gets the free part from the acquire itself.
 	 */
-	//writerWaterMark
-	//		= (RING_IO_dataBufSize2 < RINGIO_WRITE_ACQ_SIZE) ? RING_IO_dataBufSize2
-	//				: RINGIO_WRITE_ACQ_SIZE;
-	//writerWaterMark= RING_IO_dataBufSize2;
-	writerWaterMark= RINGIO_WRITE_ACQ_SIZE;
+	if (!info->writerFlexible) {
+		empty = RingIO_getEmptySize(info->writerHandle);
+		if ((empty != 0) && (empty < size)) {
+			size = empty;
+		}
+	}
 
-	do {
-		status = RingIO_setNotifier(info->writerHandle,
-				RINGIO_NOTIFICATION_ONCE, writerWaterMark,
-				&TSKRING_IO_writer_notify, (RingIO_NotifyParam) info);
-	} while (status != SYS_OK);
+	return TSKRING_IO_granule(info, size, remaining);
+}
 
-	/*
-	 *  Set the notification for Reader.
-	 */
-	// readerAcqSize = (RING_IO_dataBufSize3 < RINGIO_READ_ACQ_SIZE)?
-	//                 RING_IO_dataBufSize3 : RINGIO_READ_ACQ_SIZE ;
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_readSize
+ *
+ *  @desc   Computes the size of the next reader acquire.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_readSize(TSKRING_IO_TransferInfo * info,
+		Uint32 remaining) {
+	Uint32 size = info->scaleSize;
+	Uint32 tail = info->scaleSize;
+	Uint32 valid;
+
+	valid = RingIO_getValidSize(info->readerHandle);
+	if ((remaining != 0) && (valid > size)) {
+		size = (valid < remaining) ? valid : remaining;
+		tail = remaining;
+	}
 
+	return TSKRING_IO_granule(info, size, tail);
+}
 
-	readerAcqSize = RING_IO_dataBufSize4;
-	Buffer = MEM_calloc(DSPLINK_SEGID, readerAcqSize, DSPLINK_BUF_ALIGN);
-	if(NULL == Buffer) {
-		status = RINGIO_EFAILURE;
-		SET_FAILURE_REASON(status);
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_outNotify
+ *
+ *  @desc   Sends or defers a notification to the GPP reader.
+ *
+ *  @modif  info->notifyPendFrames, info->notifyPendBytes,
+ *          info->notifyPendStart
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_outNotify(TSKRING_IO_TransferInfo * info,
+		RingIO_NotifyMsg msg, Uint32 size) {
+	Int status = RINGIO_SUCCESS;
+	Bool due = TRUE;
+	Uint32 pendFrames = 0;
+	Uint32 pendBytes = 0;
+	Uint32 pendStart = 0;
+	Bool moderated = ((info->notifyFrames > 1u) || (info->notifyBytes != 0));
+
+	if (moderated && (msg == (RingIO_NotifyMsg) NOTIFY_DATA_START)) {
+		/* Carried by the end of frame notification */
+		due = FALSE;
+		info->stats.notifyCoalesced++;
+	} else if (moderated && (msg == (RingIO_NotifyMsg) NOTIFY_DATA_END)) {
+		/* Shared with TSKRING_IO_notifyTick */
+		SWI_disable();
+		if (info->notifyPendFrames == 0) {
+			info->notifyPendStart = CLK_gethtime();
+		}
+		info->notifyPendFrames++;
+		info->notifyPendBytes += size;
+		due = ((info->notifyPendFrames >= info->notifyFrames)
+				|| ((info->notifyBytes != 0)
+						&& (info->notifyPendBytes >= info->notifyBytes))
+				|| (info->notifyDue == TRUE));
+		if (due) {
+			pendFrames = info->notifyPendFrames;
+			pendBytes = info->notifyPendBytes;
+			pendStart = info->notifyPendStart;
+			info->notifyPendFrames = 0;
+			info->notifyPendBytes = 0;
+			info->notifyDue = FALSE;
+		} else {
+			info->stats.notifyCoalesced++;
+		}
+		SWI_enable();
+	}
+
+	if (due) {
+		status = RingIO_sendNotify(info->writerHandle, msg);
+		SWI_disable();
+		if (status == RINGIO_SUCCESS) {
+			info->stats.notifySent++;
+		} else if (pendFrames != 0) {
+			/* Keep the frames pending for the next notification or the timer */
+			if (info->notifyPendFrames == 0) {
+				info->notifyPendStart = pendStart;
+			}
+			info->notifyPendFrames += pendFrames;
+			info->notifyPendBytes += pendBytes;
+		}
+		SWI_enable();
 	}
 
-	do {
-		status = RingIO_setNotifier(info->readerHandle,
-				RINGIO_NOTIFICATION_ONCE, 0 /* readerWaterMark */,
-				&TSKRING_IO_reader_notify, (RingIO_NotifyParam) info);
-	} while (status != SYS_OK);
+	return (status);
+}
 
-	writeAcqSize = writerWaterMark;
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_notifyFlush
+ *
+ *  @desc   Sends the end of frame notification marked due by the timer.
+ *
+ *  @modif  info->notifyPendFrames, info->notifyPendBytes,
+ *          info->notifyPendStart, info->notifyDue
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_notifyFlush(TSKRING_IO_TransferInfo * info) {
+	Uint32 pendFrames = 0;
+	Uint32 pendBytes = 0;
+	Uint32 pendStart = 0;
+
+	if (info->notifyDue == TRUE) {
+		/* Shared with TSKRING_IO_notifyTick */
+		SWI_disable();
+		pendFrames = info->notifyPendFrames;
+		pendBytes = info->notifyPendBytes;
+		pendStart = info->notifyPendStart;
+		info->notifyPendFrames = 0;
+		info->notifyPendBytes = 0;
+		info->notifyDue = FALSE;
+		SWI_enable();
+
+		if (pendFrames != 0) {
+			if (RingIO_sendNotify(info->writerHandle,
+					(RingIO_NotifyMsg) NOTIFY_DATA_END) == RINGIO_SUCCESS) {
+				info->stats.notifySent++;
+			} else {
+				/* Left for the next end of frame or timer tick */
+				SWI_disable();
+				if (info->notifyPendFrames == 0) {
+					info->notifyPendStart = pendStart;
+				}
+				info->notifyPendFrames += pendFrames;
+				info->notifyPendBytes += pendBytes;
+				SWI_enable();
+			}
+		}
+	}
+}
 
-	//while (1) {
-	while (!info->exitflag) {
+/** ============================================================================
+ *  @func   TSKRING_IO_notifyTick
+ *
+ *  @desc   PRD function of the output notification timer. Runs in SWI
+ *          context, so the channel tasks update the state it shares with
+ *          SWIs disabled. The reader semaphore is posted once per due
+ *          notification, so a busy task does not pile up posts.
+ *
+ *  @modif  info->notifyDue of the channels.
+ *  ============================================================================
+ */
+Void TSKRING_IO_notifyTick(Void) {
+	TSKRING_IO_TransferInfo * info;
+	Uint32 now = CLK_gethtime();
+	Uint32 i;
 
+	/* Only channels moderated with a period are registered */
+	for (i = 0; i < NUM_CHANNELS; i++) {
+		info = TSKRING_IO_channels[i];
+		if ((info != NULL) && (info->notifyPendFrames != 0)
+				&& (info->notifyDue == FALSE)
+				&& ((now - info->notifyPendStart) >= info->notifyPeriod)) {
+			info->notifyDue = TRUE;
+			SEM_post(&(info->readerSemObj));
+		}
+	}
+}
 
-		/* Wait for the start notification from gpp */
-		semStatus = SEM_pend(&(info->readerSemObj), SYS_FOREVER);
-		if (semStatus == FALSE) {
-			status = RINGIO_EFAILURE;
-			SET_FAILURE_REASON(status);
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_eventInit
+ *
+ *  @desc   Empties the event queue of the channel.
+ *
+ *  @modif  info->events
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_eventInit(TSKRING_IO_TransferInfo * info) {
+	TSKRING_IO_EventQueue * queue = &(info->events);
+
+	queue->head = 0;
+	queue->tail = 0;
+	queue->folded = 0;
+	queue->unfolded = 0;
+	queue->selfTests = 0;
+	queue->selfTestsTaken = 0;
+	queue->exitPosted = FALSE;
+}
+
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_eventPut
+ *
+ *  @desc   Puts a notification on the event queue of the channel.
+ *
+ *  @modif  info->events, info->stats.eventsFolded
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_eventPut(TSKRING_IO_TransferInfo * info,
+		RingIO_NotifyMsg msg) {
+	TSKRING_IO_EventQueue * queue = &(info->events);
+	volatile TSKRING_IO_Event * event;
+	Uint32 head = queue->head;
+
+	if (msg == (RingIO_NotifyMsg) NOTIFY_DSP_END) {
+		queue->exitPosted = TRUE;
+	} else if (msg == (RingIO_NotifyMsg) NOTIFY_DSP_SELFTEST) {
+		queue->selfTests++;
+	} else if (msg == (RingIO_NotifyMsg) NOTIFY_DATA_START) {
+		/* Queue behind the folded starts only once they are all taken */
+		if (((head - queue->tail) < TSKRING_IO_EVENT_QUEUE_LEN)
+				&& (queue->folded == queue->unfolded)) {
+			event = &(queue->events[head & (TSKRING_IO_EVENT_QUEUE_LEN - 1u)]);
+			event->id = (Uint32) msg;
+			event->stamp = CLK_gethtime();
+			/* Publish the slot only once it is filled */
+			queue->head = head + 1u;
 		} else {
-			status = SYS_OK;
+			queue->folded++;
+			info->stats.eventsFolded++;
 		}
+	}
+}
 
-		if ((info->freadStart == TRUE) && (!info->exitflag)) {
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_eventGet
+ *
+ *  @desc   Takes the oldest event from the event queue of the channel.
+ *
+ *  @modif  info->events
+ *  ----------------------------------------------------------------------------
+ */
+static Bool TSKRING_IO_eventGet(TSKRING_IO_TransferInfo * info,
+		TSKRING_IO_Event * event) {
+	TSKRING_IO_EventQueue * queue = &(info->events);
+	volatile TSKRING_IO_Event * slot;
+	Uint32 tail = queue->tail;
+	Bool found = TRUE;
+
+	if (queue->selfTestsTaken != queue->selfTests) {
+		/* Between frames, so it may go ahead of the starts */
+		queue->selfTestsTaken++;
+		event->id = (Uint32) NOTIFY_DSP_SELFTEST;
+		event->stamp = CLK_gethtime();
+	} else if (tail != queue->head) {
+		slot = &(queue->events[tail & (TSKRING_IO_EVENT_QUEUE_LEN - 1u)]);
+		event->id = slot->id;
+		event->stamp = slot->stamp;
+		/* Free the slot only once it is read */
+		queue->tail = tail + 1u;
+	} else if (queue->unfolded != queue->folded) {
+		/* The arrival of a folded start is not known, take it from now */
+		queue->unfolded++;
+		event->id = (Uint32) NOTIFY_DATA_START;
+		event->stamp = CLK_gethtime();
+	} else if (queue->exitPosted) {
+		event->id = (Uint32) NOTIFY_DSP_END;
+		event->stamp = CLK_gethtime();
+	} else {
+		found = FALSE;
+	}
 
-			info->freadStart = FALSE;
+	return found;
+}
 
-			/* Got  data transfer start notification from DSP*/
-			do {
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_waitStart
+ *
+ *  @desc   Waits for the next start or exit event, running the self-test
+ *          on the way when asked, and reads the start attribute.
+ *
+ *  @modif  info->arrivalTime, info->exitflag, info->packIn, info->stats
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_waitStart(TSKRING_IO_TransferInfo * info,
+		Uint32 * param, Uint32 * packSize, Bool * frameEnd) {
+	Int status = SYS_OK;
+	Int attrStatus;
+	TSKRING_IO_Event event;
+	Bool done = FALSE;
+	Uint16 type = 0;
+	Uint32 keys;
+	Uint32 size;
+	Uint32 bytes;
 
-				/* Get the start attribute from dsp */
-				status = RingIO_getAttribute(info->readerHandle, &type, &param);
-				if ((status == RINGIO_SUCCESS) || (status
-						== RINGIO_SPENDINGATTRIBUTE)) {
+	while ((!done) && (status == SYS_OK)) {
+		/* Idle between frames: send what the timer found due */
+		TSKRING_IO_notifyFlush(info);
 
-					if (type == (Uint16) RINGIO_DATA_START) {
-						/*RING_IO_0Print ("GPP<--DSP1:Received Data Transfer"
-						 "Start Attribute\n") ;*/
-						break;
+		if (TSKRING_IO_eventGet(info, &event)) {
+			/* Take the count posted with the event, so that it does not
+			 * wake a later pend for nothing. It may be gone already.
+			 */
+			(Void) SEM_pend(&(info->readerSemObj), 0);
+
+			if (event.id == (Uint32) NOTIFY_DATA_START) {
+				attrStatus = RingIO_getAttribute(info->readerHandle, &type,
+						param);
+				if (attrStatus == RINGIO_EVARIABLEATTRIBUTE) {
+					/* A packed record may open the frame */
+					bytes = sizeof(info->packIn);
+					attrStatus = RingIO_getvAttribute(info->readerHandle,
+							&type, param, info->packIn, &bytes);
+					if (((attrStatus == RINGIO_SUCCESS)
+							|| (attrStatus == RINGIO_SPENDINGATTRIBUTE))
+							&& (type == (Uint16) RINGIO_DATA_PACKED)) {
+						keys = TSKRING_IO_unpack(info, bytes, param, &size);
+						if ((keys & RING_IO_PACK_BIT(RINGIO_DATA_START)) != 0) {
+							type = (Uint16) RINGIO_DATA_START;
+							*packSize = size;
+							/* The record may end the frame too, after the
+							 * chunk it sizes if any
+							 */
+							*frameEnd = ((keys
+									& RING_IO_PACK_BIT(RINGIO_DATA_END)) != 0);
+						}
 					}
-
 				}
 
-			} while ((status != RINGIO_SUCCESS) && (status
-					!= RINGIO_SPENDINGATTRIBUTE)  && (!info->exitflag));
-		}
-
-		info->readerRecvSize = readerAcqSize; //the size of RingIO_acquire
-		info->scaleSize = readerAcqSize; //the size of the rest of the RingIO_acquire
-		while ((exitFlag == FALSE)  && (!info->exitflag)) {
-			rdRingStatus = RingIO_acquire(info->readerHandle,
-					(RingIO_BufPtr *) &(info->readerBuf),
-					&(info->readerRecvSize));
-
-			if ((rdRingStatus == RINGIO_EFAILURE) || (rdRingStatus
-					== RINGIO_EBUFEMPTY)) {
-				/* Wait for the read buffer to be available */
-				semStatus = SEM_pend(&(info->readerSemObj), SYS_FOREVER);
-				if (semStatus == FALSE) {
-					status = RINGIO_EFAILURE;
-					SET_FAILURE_REASON(status);
+				if (((attrStatus == RINGIO_SUCCESS)
+						|| (attrStatus == RINGIO_SPENDINGATTRIBUTE))
+						&& (type == (Uint16) RINGIO_DATA_START)) {
+					info->arrivalTime = event.stamp;
+					done = TRUE;
 				} else {
-					status = SYS_OK;
+					/* Not the start of a frame, wait for the next one */
+					info->stats.startsMissed++;
+					SET_FAILURE_REASON(attrStatus);
 				}
-			} else if ((rdRingStatus == RINGIO_SUCCESS)
-					|| ((info->readerRecvSize > 0) && ((rdRingStatus
-							== RINGIO_ENOTCONTIGUOUSDATA) || (rdRingStatus
-							== RINGIO_EBUFWRAP) || (rdRingStatus
-							== RINGIO_SPENDINGATTRIBUTE)))) {
-				/* Acquired Read buffer.Copy input received data
-				 *to output buffer and  process the buffer as
-				 *specified in the received  variable attribute
-				 */
-				info->scaleSize -= info->readerRecvSize;
-
-
-/*
-				//debug
-						
-							do {
-								wrRingStatus = RingIO_sendNotify(info->writerHandle,
-										(RingIO_NotifyMsg)info->readerBuf[0] );
-								if (wrRingStatus != RINGIO_SUCCESS) {
-									SET_FAILURE_REASON(wrRingStatus);
-								}
-							} while (wrRingStatus != RINGIO_SUCCESS);
-						
-
+			} else if (event.id == (Uint32) NOTIFY_DSP_END) {
+				info->exitflag = TRUE;
+				done = TRUE;
+			} else if (event.id == (Uint32) NOTIFY_DSP_SELFTEST) {
+				/* Between frames, so the channel data is left alone */
+				TSKRING_IO_selfTest(info);
+			}
+		} else if (SEM_pend(&(info->readerSemObj), SYS_FOREVER) == FALSE) {
+			status = RINGIO_EFAILURE;
+			SET_FAILURE_REASON(status);
+		}
+	}
 
+	return status;
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_exitCheck
+ *
+ *  @desc   Sets exitflag once NOTIFY_DSP_END has arrived.
+ *
+ *  @modif  info->exitflag
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_exitCheck(TSKRING_IO_TransferInfo * info) {
+	if (info->events.exitPosted) {
+		info->exitflag = TRUE;
+	}
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_granule
+ *
+ *  @desc   Rounds an acquire size down to the acquire granule.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_granule(TSKRING_IO_TransferInfo * info, Uint32 size,
+		Uint32 tail) {
+	Uint32 granule = info->acqGranule;
 
-				//debug*/
-				
+	if ((granule > 1u) && (size < tail) && (size >= granule)) {
+		size -= (size % granule);
+	}
 
-				if (Buffer && info->readerBuf) {
-					if ((totalRcvbytes + info->readerRecvSize) <= readerAcqSize)
-						memcpy((Buffer + totalRcvbytes), info->readerBuf,
-								info->readerRecvSize);
+	return size;
+}
 
-					//debug
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_repeatHit
+ *
+ *  @desc   Checks whether the frame repeats the last processed one.
+ *
+ *  @modif  buffer, info->repeatFrame, info->lastHash, info->lastSize,
+ *          info->repeatBuf, info->repeatValid, info->stats
+ *  ----------------------------------------------------------------------------
+ */
+static Bool TSKRING_IO_repeatHit(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size) {
+	Bool hit = FALSE;
+	Uint32 hash;
+
+	if ((info->repeatCheck == TRUE) && (info->degraded == TRUE)) {
+		/* The fallback output must not be sent for a full frame */
+		info->repeatValid = FALSE;
+		info->lastSize = 0;
+	} else if (info->repeatCheck == TRUE) {
+		/* The output also depends on the scale parameters */
+		hash = RING_IO_hash(info->frameHash, &(info->scalingFactor),
+				sizeof(info->scalingFactor));
+		hash = RING_IO_hash(hash, &(info->scaleOpCode),
+				sizeof(info->scaleOpCode));
+		hash = RING_IO_hash(hash, &(info->sampleFormat),
+				sizeof(info->sampleFormat));
+
+		info->stats.repeatChecks++;
+		if ((info->repeatValid == TRUE) && (hash == info->lastHash)
+				&& (size == info->lastSize)
+				&& (memcmp(buffer, info->repeatBuf, size) == 0)) {
+			hit = TRUE;
+			info->stats.repeatHits++;
+			if (info->repeatAttr == TRUE) {
+				info->repeatFrame = TRUE;
+			} else {
+				memcpy(buffer, info->repeatOut, size);
+			}
+		} else {
+			/* Keep the input, the stages work in place */
+			info->repeatValid = FALSE;
+			info->lastHash = hash;
+			info->lastSize = size;
+			memcpy(info->repeatBuf, buffer, size);
+		}
+	}
 
-							/* Sending the Hard Notification to gpp reader */
-					/*		do {
-								wrRingStatus = RingIO_sendNotify(info->writerHandle,
-										(RingIO_NotifyMsg)Buffer[0] );
-								if (wrRingStatus != RINGIO_SUCCESS) {
-									SET_FAILURE_REASON(wrRingStatus);
-								}
-							} while (wrRingStatus != RINGIO_SUCCESS);*/
+	return (hit);
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_repeatSave
+ *
+ *  @desc   Keeps the output of a processed frame. A frame cut short by the
+ *          budget is not kept.
+ *
+ *  @modif  info->repeatOut, info->repeatValid
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_repeatSave(TSKRING_IO_TransferInfo * info, Char * buffer,
+		Uint32 size) {
+	if ((info->repeatCheck == TRUE) && (info->lastSize == size)
+			&& (size != 0) && (info->procAborted == FALSE)) {
+		if (info->repeatAttr == FALSE) {
+			memcpy(info->repeatOut, buffer, size);
+		}
+		info->repeatValid = TRUE;
+	}
+}
 
-					//debug
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_readFrame
+ *
+ *  @desc   Reads a frame from the input RingIO into the frame buffer, with
+ *          the stages run on it while the copy engine moves each chunk.
+ *
+ *  @modif  buffer, info
+ *  ----------------------------------------------------------------------------
+ */
+static Uint32 TSKRING_IO_readFrame(TSKRING_IO_TransferInfo * info,
+		Char * buffer, Uint32 acqSize, Uint32 packSize, Bool frameEnd) {
+	Int rdRingStatus;
+	Bool semStatus;
+	Bool exitFlag = FALSE;
+	Bool endAfter = FALSE;
+	Bool useEngine;
+	Bool trimmed;
+	Uint32 totalRcvbytes = 0;
+	Uint32 got;
+	Uint32 i;
+	Uint32 j;
+	Uint16 type;
+	Uint32 param;
+	Uint32 keys;
 
+	info->readerRecvSize = acqSize; //the size of RingIO_acquire
+	info->scaleSize = acqSize; //the size of the rest of the RingIO_acquire
+	if (packSize != 0) {
+		/* The size of the first chunk came with the start, and an
+		 * end in the same record follows that chunk
+		 */
+		info->scaleSize = packSize;
+		info->readerRecvSize = packSize;
+		endAfter = frameEnd;
+	} else {
+		exitFlag = frameEnd;
+	}
+	while ((exitFlag == FALSE) && (!info->exitflag)) {
+		if (info->greedyRead) {
+			info->readerRecvSize = TSKRING_IO_readSize(info,
+					(totalRcvbytes < acqSize) ? (acqSize - totalRcvbytes) : 0);
+		} else {
+			info->readerRecvSize = TSKRING_IO_granule(info,
+					info->readerRecvSize, info->scaleSize);
+		}
+		rdRingStatus = RingIO_acquire(info->readerHandle,
+				(RingIO_BufPtr *) &(info->readerBuf),
+				&(info->readerRecvSize));
+
+		if ((rdRingStatus == RINGIO_EFAILURE) || (rdRingStatus
+				== RINGIO_EBUFEMPTY)) {
+			/* Wait for the read buffer to be available */
+			semStatus = SEM_pend(&(info->readerSemObj), SYS_FOREVER);
+			if (semStatus == FALSE) {
+				SET_FAILURE_REASON(RINGIO_EFAILURE);
+			}
+			TSKRING_IO_exitCheck(info);
+		} else if ((rdRingStatus == RINGIO_SUCCESS)
+				|| ((info->readerRecvSize > 0) && ((rdRingStatus
+						== RINGIO_ENOTCONTIGUOUSDATA) || (rdRingStatus
+						== RINGIO_EBUFWRAP) || (rdRingStatus
+						== RINGIO_SPENDINGATTRIBUTE)))) {
+			/* Acquired Read buffer.Copy input received data
+			 *to output buffer and  process the buffer as
+			 *specified in the received  variable attribute
+			 */
+			/* Keep whole granules of a short acquire, the rest is given
+			 * back after the release and acquired again
+			 */
+			got = TSKRING_IO_granule(info, info->readerRecvSize,
+					info->scaleSize);
+			trimmed = (got < info->readerRecvSize);
+			info->readerRecvSize = got;
+
+			/* A greedy acquire may span the rest of the segment */
+			info->scaleSize -= (info->readerRecvSize < info->scaleSize) ?
+					info->readerRecvSize : info->scaleSize;
+			info->stats.readAcquires++;
+
+			if ((info->prefetchNext == TRUE) && (info->readerBuf != NULL)) {
+				/* Touch the next span before this one is copied and run */
+				TSKRING_IO_prefetchNext(info, acqSize);
+			}
 
+			if (buffer && info->readerBuf && (!info->dropFrame)) {
+				if ((totalRcvbytes + info->readerRecvSize) <= acqSize) {
+					useEngine = ((RING_IO_COPY_OVERLAP == TRUE)
+							&& (info->asyncCopy == TRUE)
+							&& (info->sampleFormat == RING_IO_FMT_NATIVE));
+					if (useEngine == TRUE) {
+						RING_IO_copySubmit(info->copyEngine,
+								buffer + totalRcvbytes, info->readerBuf,
+								info->readerRecvSize);
+					}
+					if (info->repeatCheck == TRUE) {
+						info->frameHash = RING_IO_hash(info->frameHash,
+								info->readerBuf, info->readerRecvSize);
+					}
 
+					/* Run the stages on the blocks already in the frame
+					 * while this chunk is copied, short of the cache line
+					 * the copy starts in
+					 */
+					if ((useEngine == TRUE) && (info->repeatCheck == FALSE)
+							&& (!info->passFrame) && (!info->exitflag)) {
+						TSKRING_IO_runBlocks(info, buffer,
+								totalRcvbytes & ~(RING_IO_COPY_LINE - 1u),
+								FALSE);
+					}
 
-					
+					if (useEngine == TRUE) {
+						RING_IO_copyWait(info->copyEngine);
+					} else {
+						/* Copy and convert the byte order in one pass */
+						RING_IO_copySwap(buffer, totalRcvbytes,
+								info->readerBuf, info->readerRecvSize,
+								acqSize, info->sampleFormat);
+					}
 				}
-
-				totalRcvbytes += info->readerRecvSize;
-
-				/* Release the input buffer(reader buffer) */
-				rdRingStatus = RingIO_release(info->readerHandle,
-						info->readerRecvSize);
+			}
+			totalRcvbytes += info->readerRecvSize;
+
+			/* Release the input buffer(reader buffer) */
+			rdRingStatus = RingIO_release(info->readerHandle,
+					info->readerRecvSize);
+			if (RINGIO_SUCCESS != rdRingStatus) {
+				SET_FAILURE_REASON(rdRingStatus);
+			} else if (trimmed == TRUE) {
+				rdRingStatus = RingIO_cancel(info->readerHandle);
 				if (RINGIO_SUCCESS != rdRingStatus) {
 					SET_FAILURE_REASON(rdRingStatus);
-
-				}
-				/* Set the acqSize for the next acquire */
-				if (info->scaleSize == 0) {
-					/* Reset  the rcvSize to  size of the full buffer  */
-					info->scaleSize = RING_IO_dataBufSize4;
-					info->readerRecvSize = RING_IO_dataBufSize4;
-				} else {
-					/*Acquire the partial buffer  in next acquire */
-					info->readerRecvSize = info->scaleSize;
 				}
-
 			}
-
-			else if (rdRingStatus == RINGIO_SPENDINGATTRIBUTE) {
-
-				rdRingStatus = RingIO_getAttribute(info->readerHandle, &type,
-						&param);
+			if ((endAfter == TRUE) && (info->scaleSize == 0)) {
+				/* Last chunk of the frame, its end came with it */
+				endAfter = FALSE;
+				exitFlag = TRUE;
+			}
+			/* Set the acqSize for the next acquire */
+			if (info->scaleSize == 0) {
+				/* Reset  the rcvSize to  size of the full buffer  */
+				info->scaleSize = acqSize;
+				info->readerRecvSize = acqSize;
+			} else {
+				/*Acquire the partial buffer  in next acquire */
+				info->readerRecvSize = info->scaleSize;
+			}
+		} else if (rdRingStatus == RINGIO_SPENDINGATTRIBUTE) {
+			rdRingStatus = RingIO_getAttribute(info->readerHandle, &type,
+					&param);
+			if ((RINGIO_SUCCESS == rdRingStatus)
+					|| (RINGIO_SPENDINGATTRIBUTE == rdRingStatus)) {
+
+				/* Got the fixed attribute */
+				if (type == RINGIO_DATA_END) {
+					/* End of data transfer from DSP */
+					exitFlag = TRUE;
+				} else if (type == RINGIO_DATA_FORMAT) {
+					/* Byte order of the following samples */
+					info->sampleFormat = param;
+				}
+			} else if (rdRingStatus == RINGIO_EVARIABLEATTRIBUTE) {
+				j = sizeof(info->packIn);
+				rdRingStatus = RingIO_getvAttribute(info->readerHandle,
+						&type, &i, info->packIn, &j);
 				if ((RINGIO_SUCCESS == rdRingStatus)
 						|| (RINGIO_SPENDINGATTRIBUTE == rdRingStatus)) {
 
-					/* Got the fixed attribute */
-					if (type == RINGIO_DATA_END) {
-						/* End of data transfer from DSP */
-
-						exitFlag = TRUE;
-					}
-				} else if (rdRingStatus == RINGIO_EVARIABLEATTRIBUTE) {
-					j = sizeof(attrs);
-					rdRingStatus = RingIO_getvAttribute(info->readerHandle,
-							&type, &i, attrs, &j);
-					if ((RINGIO_SUCCESS == rdRingStatus)
-							|| (RINGIO_SPENDINGATTRIBUTE == rdRingStatus)) {
-
-						/* got the variable attribute */
-						//readerAcqSize = attrs[0];
-
-						//info->scaleSize = attrs[0];
-						info->scaleSize = attrs[0];
-						info->readerRecvSize = info->scaleSize;
-					} else if (RINGIO_EVARIABLEATTRIBUTE == rdRingStatus) {
-
-						/* This case should not arise.
-						 * as we have provided the sufficient buffer
-						 * to receive variable Attribute
-						 */
-						SET_FAILURE_REASON(rdRingStatus);
+					/* got the variable attribute */
+					if (type == (Uint16) RINGIO_DATA_PACKED) {
+						keys = TSKRING_IO_unpack(info, j, &param,
+								&(info->scaleSize));
+						if (((keys & RING_IO_PACK_BIT(RINGIO_DATA_END)) != 0)
+								&& ((keys & RING_IO_PACK_BIT(RING_IO_PACK_SIZE)) != 0)
+								&& (info->scaleSize != 0)) {
+							/* The end follows the chunk the record sizes */
+							endAfter = TRUE;
+						} else if ((keys & RING_IO_PACK_BIT(RINGIO_DATA_END)) != 0) {
+							exitFlag = TRUE;
+						}
 					} else {
-						/* For RINGIO_EPENDINGDATA, RINGIO_EFAILURE
-						 * nothing to be done. go and  read data again
-						 */
+						info->scaleSize = info->packIn[RING_IO_VATTR_SIZE];
 					}
+					info->readerRecvSize = info->scaleSize;
+				} else if (RINGIO_EVARIABLEATTRIBUTE == rdRingStatus) {
+
+					/* This case should not arise.
+					 * as we have provided the sufficient buffer
+					 * to receive variable Attribute
+					 */
+					SET_FAILURE_REASON(rdRingStatus);
 				} else {
-					/* For other return status
-					 * (RINGIO_EPENDINGDATA,RINGIO_EFAILURE)
-					 * no thing o be done. go and read the data again
+					/* For RINGIO_EPENDINGDATA, RINGIO_EFAILURE
+					 * nothing to be done. go and  read data again
 					 */
-
 				}
 			} else {
-				/* For Any other  wrRingStatus,Consider it as failure */
-				status = RINGIO_EFAILURE;
-				SET_FAILURE_REASON(status);
-			}
-			/* Reset the acquired size if it is changed to zero by the
-			 * failed acquire call
-			 */
-			if (info->readerRecvSize == 0) {
-				info->readerRecvSize = info->scaleSize;
+				/* For other return status
+				 * (RINGIO_EPENDINGDATA,RINGIO_EFAILURE)
+				 * no thing o be done. go and read the data again
+				 */
 			}
-
+		} else {
+			/* For Any other  wrRingStatus,Consider it as failure */
+			SET_FAILURE_REASON(RINGIO_EFAILURE);
 		}
+		/* Reset the acquired size if it is changed to zero by the
+		 * failed acquire call
+		 */
+		if (info->readerRecvSize == 0) {
+			info->readerRecvSize = info->scaleSize;
+		}
+	}
+	info->frameBytes = totalRcvbytes;
 
-		//totalRcvbytes = 0;
-		info->readerRecvSize = readerAcqSize; //the size of RingIO_acquire
-		info->scaleSize = readerAcqSize; //the size of the rest of the RingIO_acquire
-		info->freadEnd = FALSE;
-		exitFlag = FALSE;
-
-		///////////////////////////////////////////////////////////////////////////////
-		//End  the read  task
-		///////////////////////////////////////////////////////////////////////////////
-
+	return (totalRcvbytes);
+}
 
-		///////////////////////////////////////////////////////////////////////////////
-		//To do the algorithms with the Buffer (RING_IO_dataBufSize3)
-		///////////////////////////////////////////////////////////////////////////////
-		//if( && (!info->exitflag))
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_prefetchNext
+ *
+ *  @desc   Touches the next pending span of the input RingIO.
+ *
+ *  @modif  info->inNext, info->inBase, info->inEnd, info->inTouched,
+ *          info->inTouchedSize
+ *  ----------------------------------------------------------------------------
+ */
+static Void TSKRING_IO_prefetchNext(TSKRING_IO_TransferInfo * info,
+		Uint32 limit) {
+	Char * next = info->readerBuf + RING_IO_MAUS(info->readerRecvSize);
+	Uint32 size = 0;
+	Uint32 valid;
 
+	/* The acquire no longer invalidates the span */
+	if ((info->readerBuf < info->inTouched) || (next > (info->inTouched
+			+ RING_IO_MAUS(info->inTouchedSize)))) {
+		BCACHE_inv(info->readerBuf, info->readerRecvSize, TRUE);
+	}
 
-		///////////////////////////////////////////////////////////////////////////////
-		//END To do the algorithms with the Buffer (RING_IO_dataBufSize3)
-		///////////////////////////////////////////////////////////////////////////////
+	/* Spans follow each other until the reader wraps */
+	if ((info->inNext != NULL) && (info->readerBuf != info->inNext)) {
+		info->inEnd = info->inNext;
+		info->inBase = info->readerBuf;
+	}
+	info->inNext = next;
 
+	if (info->inEnd != NULL) {
+		if (next >= info->inEnd) {
+			next = info->inBase;
+		}
+		valid = RingIO_getValidSize(info->readerHandle);
+		size = RING_IO_BYTES((Uint32) (info->inEnd - next));
+		size = (valid < size) ? valid : size;
+		size = (limit < size) ? limit : size;
+	}
 
-		///////////////////////////////////////////////////////////////////////////////
-		//start  the write  task
-		///////////////////////////////////////////////////////////////////////////////
+	if (size != 0) {
+		/* Released by the GPP, so nothing writes it until it is read */
+		BCACHE_inv(next, size, TRUE);
+		RING_IO_prefetch(next, size);
+	}
+	info->inTouched = next;
+	info->inTouchedSize = size;
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_writeFrame
+ *
+ *  @desc   Writes a frame from the frame buffer to the output RingIO, between
+ *          its start and end attributes, and notifies the GPP reader.
+ *
+ *  @modif  info
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_writeFrame(TSKRING_IO_TransferInfo * info,
+		Char * buffer, Uint32 size, Uint32 bufSize) {
+	Int wrRingStatus = RINGIO_SUCCESS;
+	Bool semStatus;
+	Bool lastChunk;
+	Uint16 type;
+	Uint32 writeAcqSize;
+	Uint32 bytesTransfered = 0;
+	RING_IO_View outView;
+	RING_IO_View frameView;
+
+	if ((!info->exitflag) && (info->packAttrs == TRUE)) {
+		/* Set and notified with the first packed record of the frame */
+		info->packWords = 0;
+		info->packStart = TRUE;
+		TSKRING_IO_packPut(info, RINGIO_DATA_START, 0);
+	} else if (!info->exitflag) {
+		type = (Uint16) RINGIO_DATA_START;
+		/* Set the attribute start attribute to output */
+		wrRingStatus = RingIO_setAttribute(info->writerHandle, 0, type, 0);
+		if (wrRingStatus != RINGIO_SUCCESS) {
+			SET_FAILURE_REASON(wrRingStatus);
+		} else {
+			/* Sending the Hard Notification to gpp reader */
+			do {
+				wrRingStatus = TSKRING_IO_outNotify(info,
+						(RingIO_NotifyMsg) NOTIFY_DATA_START, 0);
+				if (wrRingStatus != RINGIO_SUCCESS) {
+					SET_FAILURE_REASON(wrRingStatus);
+				}
+			} while ((wrRingStatus != RINGIO_SUCCESS) && (!info->exitflag));
+		}
+	}
 
-		if ((RINGIO_SUCCESS == wrRingStatus)  && (!info->exitflag)) {
-			type = (Uint16) RINGIO_DATA_START;
-			/* Set the attribute start attribute to output */
-			wrRingStatus = RingIO_setAttribute(info->writerHandle, 0, type, 0);
-			if (wrRingStatus != RINGIO_SUCCESS) {
-				SET_FAILURE_REASON(wrRingStatus);
-			} else {
-				/* Sending the Hard Notification to gpp reader */
-				do {
-					wrRingStatus = RingIO_sendNotify(info->writerHandle,
-							(RingIO_NotifyMsg) NOTIFY_DATA_START);
-					if (wrRingStatus != RINGIO_SUCCESS) {
-						SET_FAILURE_REASON(wrRingStatus);
-					}
-				} while (wrRingStatus != RINGIO_SUCCESS);
-			}
+	if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
+		/* Tag shed and unprocessed frames for the GPP reader */
+		wrRingStatus = TSKRING_IO_markFrame(info, size);
+		if ((info->dropFrame) || (info->repeatFrame)) {
+			size = 0;
 		}
+	}
 
-		if ((RINGIO_SUCCESS == wrRingStatus)  && (!info->exitflag)) {
-			//while ((RING_IO_dataBufSize2 == 0) || (bytesTransfered
-			while ((bytesTransfered < totalRcvbytes)  && (!info->exitflag)) {
-				/* Update the attrs to send variable attribute to DSP*/
-				attrs[0] = RINGIO_WRITE_ACQ_SIZE;
-				wrRingStatus = RingIO_setvAttribute(info->writerHandle, 0, 0,
-						0, attrs, sizeof(attrs));
+	if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
+		while ((bytesTransfered < size) && (!info->exitflag)) {
+			/* Acquire no more than the rest of the frame or the free space */
+			writeAcqSize = TSKRING_IO_writeSize(info, size - bytesTransfered);
+
+			/* Acquire writer bufs and initialize and release them. */
+			info->writerRecvSize = writeAcqSize;
+			wrRingStatus = RingIO_acquire(info->writerHandle,
+					(RingIO_BufPtr *) &(info->writerBuf),
+					&(info->writerRecvSize));
+
+			if ((wrRingStatus == RINGIO_EFAILURE) || (wrRingStatus
+					== RINGIO_EBUFFULL)) {
+				/* Wait for Writer notification */
+				semStatus = SEM_pend(&(info->writerSemObj), SYS_FOREVER);
+				if (semStatus == FALSE) {
+					SET_FAILURE_REASON(RINGIO_EFAILURE);
+				}
+			} else if ((wrRingStatus == RINGIO_SUCCESS)
+					|| ((info->writerFlexible)
+							&& (info->writerRecvSize > 0)
+							&& (wrRingStatus == RINGIO_EBUFWRAP))) {
+
+				/* Acquired the output buffer. A flexible writer may get
+				 * less than writeAcqSize and continues with the rest
+				 * of the frame in the next acquire.
+				 */
+				if (info->writerRecvSize < writeAcqSize) {
+					info->stats.writePartials++;
+				}
 
-				if (wrRingStatus == RINGIO_EWRONGSTATE) {
+				/* Tell the GPP the size that is released, at the start
+				 * of the acquired buffer
+				 */
+				attrs[0] = info->writerRecvSize;
+				lastChunk = ((bytesTransfered + info->writerRecvSize) >= size);
+				if (info->packAttrs == TRUE) {
+					TSKRING_IO_packPut(info, RING_IO_PACK_SIZE,
+							info->writerRecvSize);
+					if (lastChunk == TRUE) {
+						/* The end of the frame goes with its last chunk */
+						TSKRING_IO_packPut(info, RINGIO_DATA_END, 0);
+					}
+					wrRingStatus = TSKRING_IO_packFlush(info);
+					if ((wrRingStatus != RINGIO_SUCCESS)
+							&& (lastChunk == TRUE)) {
+						/* Take the end back, the retry may be shorter */
+						info->packWords -= 2u;
+					}
 				} else {
-					/* Acquire writer bufs and initialize and release them. */
-					info->writerRecvSize = RINGIO_WRITE_ACQ_SIZE;
-					wrRingStatus = RingIO_acquire(info->writerHandle,
-							(RingIO_BufPtr *) &(info->writerBuf),
-							&(info->writerRecvSize));
-
-					if ((wrRingStatus == RINGIO_EFAILURE) || (wrRingStatus
-							== RINGIO_EBUFFULL)) {
-						/* Wait for Writer notification */
-						semStatus
-								= SEM_pend(&(info->writerSemObj), SYS_FOREVER);
-						if (semStatus == FALSE) {
-							status = RINGIO_EFAILURE;
-							SET_FAILURE_REASON(status);
-						} else {
-							status = SYS_OK;
-						}
-					} else if (wrRingStatus == RINGIO_SUCCESS) {
+					wrRingStatus = RingIO_setvAttribute(info->writerHandle,
+							0, 0, 0, attrs, sizeof(attrs));
+				}
 
-						/* Successfully acquired the output buffer of size equal to
-						 * writeAcqSize
+				if (wrRingStatus != RINGIO_SUCCESS) {
+					/* Give the buffer back and try the chunk again */
+					SET_FAILURE_REASON(wrRingStatus);
+					wrRingStatus = RingIO_cancel(info->writerHandle);
+					if (RINGIO_SUCCESS != wrRingStatus) {
+						SET_FAILURE_REASON(wrRingStatus);
+					}
+					TSK_yield();
+				} else {
+					/* Copy the processed frame to the output buffer */
+					if (info->writerBuf != NULL) {
+						RING_IO_VIEW_INIT(&outView, info->writerBuf,
+								info->writerRecvSize, RING_IO_Mau, 0, 1u);
+						RING_IO_VIEW_INIT(&frameView,
+								buffer + RING_IO_MAUS(bytesTransfered),
+								(bytesTransfered < bufSize) ?
+										(bufSize - bytesTransfered) : 0,
+								RING_IO_Mau, 0, 1u);
+						RING_IO_viewCopy(&outView, &frameView);
+					}
+					/* The acquire never exceeds the rest of the frame */
+					wrRingStatus = RingIO_release(info->writerHandle,
+							info->writerRecvSize);
+					if (RINGIO_SUCCESS != wrRingStatus) {
+						SET_FAILURE_REASON(wrRingStatus);
+					} else {
+						bytesTransfered += info->writerRecvSize;
+						/* Fixed size acquires would have cancelled the
+						 * tail past the end of the frame
 						 */
-						//Initial the write buffer
-						ptr8 = (Uint8 *) (info->writerBuf);
-						if (info->writerBuf != NULL) {
-							for (i = 0;
-									((i < info->writerRecvSize)
-											&& ((i + bytesTransfered)
-													< totalRcvbytes)); i++) {
-
-								*ptr8 = Buffer[(i + bytesTransfered)];
-								//*ptr8 = 10;
-								ptr8++;
-
-							}
-						}
-						if (((bytesTransfered
-								+ info->writerRecvSize) > totalRcvbytes)) {
-
-							/* we have acquired more buffer than the rest of data
-							 * bytes to be transferred */
-							if (bytesTransfered != totalRcvbytes) {
-
-								wrRingStatus
-										= RingIO_release(info->writerHandle,
-												(totalRcvbytes
-														- bytesTransfered));
-								if (RINGIO_SUCCESS != wrRingStatus) {
-									SET_FAILURE_REASON(wrRingStatus);
-								}
-							}
-
-							/* Cancel the  rest of the buffer */
-							wrRingStatus = RingIO_cancel(info->writerHandle);
-							if (RINGIO_SUCCESS != wrRingStatus) {
-								SET_FAILURE_REASON(wrRingStatus);
-							}
-							bytesTransfered = totalRcvbytes;
-
-						} else {
-							wrRingStatus = RingIO_release(info->writerHandle,
-									info->writerRecvSize);
-							if (RINGIO_SUCCESS != wrRingStatus) {
-								SET_FAILURE_REASON(wrRingStatus);
-							} else {
-								bytesTransfered += info->writerRecvSize;
-							}
+						if ((lastChunk == TRUE)
+								&& ((size % RINGIO_WRITE_ACQ_SIZE) != 0)) {
+							info->stats.ctrlOpsSaved++;
 						}
+					}
+				}
+			}
+		}
 
+		if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
+			/* Send  End of  data transfer attribute to DSP */
+			type = (Uint16) RINGIO_DATA_END;
+			if (info->packAttrs == TRUE) {
+				/* Else the end went out with the last chunk */
+				if (info->packWords != 0) {
+					/* No data went out: the whole frame is one record */
+					TSKRING_IO_packPut(info, type, 0);
+					wrRingStatus = TSKRING_IO_packFlush(info);
+					if (wrRingStatus != RINGIO_SUCCESS) {
+						SET_FAILURE_REASON(wrRingStatus);
 					}
-
 				}
-			}
-
-			bytesTransfered = 0;
-			totalRcvbytes = 0;
-			if ((RINGIO_SUCCESS == wrRingStatus)  && (!info->exitflag)) {
-
-				/* Send  End of  data transfer attribute to DSP */
-				type = (Uint16) RINGIO_DATA_END;
+			} else {
 				do {
-					wrRingStatus = RingIO_setAttribute(info->writerHandle, 0, type,
-							0);
+					wrRingStatus = RingIO_setAttribute(info->writerHandle, 0,
+							type, 0);
 					if (wrRingStatus != RINGIO_SUCCESS) {
 						SET_FAILURE_REASON(wrRingStatus);
-					} else {
-						status = RINGIO_SUCCESS;
-						
 					}
-				} while (RINGIO_SUCCESS != wrRingStatus);
+				} while ((RINGIO_SUCCESS != wrRingStatus) && (!info->exitflag));
 			}
-			if ((RINGIO_SUCCESS == wrRingStatus)  && (!info->exitflag)) {
-
-				/* Send Notification  to  the reader (DSP)
-				 * This allows DSP  application to come out from blocked state  if
-				 * it is waiting for Data buffer and  GPP sent only data end
-				 * attribute.
-				 */
-				wrRingStatus = RingIO_sendNotify(info->writerHandle,
-						(RingIO_NotifyMsg) NOTIFY_DATA_END);
-				if (wrRingStatus != RINGIO_SUCCESS) {
-					SET_FAILURE_REASON(wrRingStatus);
-				} else {
-					status = RINGIO_SUCCESS;
-					TSK_yield();
-					
-				}
+		}
+		if ((RINGIO_SUCCESS == wrRingStatus) && (!info->exitflag)) {
+			/* Send Notification  to  the reader (DSP)
+			 * This allows DSP  application to come out from blocked state  if
+			 * it is waiting for Data buffer and  GPP sent only data end
+			 * attribute.
+			 */
+			wrRingStatus = TSKRING_IO_outNotify(info,
+					(RingIO_NotifyMsg) NOTIFY_DATA_END, bytesTransfered);
+			if (wrRingStatus != RINGIO_SUCCESS) {
+				SET_FAILURE_REASON(wrRingStatus);
+			} else {
+				TSK_yield();
 			}
 		}
 	}
 
-	status = MEM_free(DSPLINK_SEGID, Buffer, RING_IO_dataBufSize4);
-
-	return (status);
+	return (wrRingStatus);
 }
 
-/** ============================================================================
- *  @func   TSKRING_IO_delete
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_selfTest
  *
- *  @desc   Delete phase function for the application. It deallocates
- *          all the resources  allocated during create phase of the
- *          application.
+ *  @desc   Loopback self-benchmark over two local RingIOs, through the
+ *          reader and writer of the frame loop.
  *
- *  @modif  None.
- *  ============================================================================
+ *  @modif  info->stats
+ *  ----------------------------------------------------------------------------
  */
-Int TSKRING_IO_delete1(TSKRING_IO_TransferInfo * info) {
+static Int TSKRING_IO_selfTest(TSKRING_IO_TransferInfo * info) {
 	Int status = SYS_OK;
-	Int tmpStatus = SYS_OK;
-	Bool freeStatus = FALSE;
-	Uint32 size = 0;
+	Int tmpStatus;
+	RingIO_Attrs ringIoAttrs;
+	Char inName[RING_IO_NAME_LEN];
+	Char outName[RING_IO_NAME_LEN];
+	Bool inCreated = FALSE;
+	Bool outCreated = FALSE;
+	RingIO_Handle genHandle = NULL;
+	RingIO_Handle inHandle = NULL;
+	RingIO_Handle outHandle = NULL;
+	RingIO_Handle drainHandle = NULL;
+	TSKRING_IO_TransferInfo * test = NULL;
+	Uint32 flags;
+	Char * source = NULL;
+	Char * frame = NULL;
+	Uint32 stageTime[TSKRING_IO_MAX_STAGES];
+	Uint32 pathTime = 0;
+	Uint32 bestTime = 0xFFFFFFFFu;
+	Uint32 frameStart;
+	Uint32 size;
+	Uint32 countsPerMs;
+	Uint32 n;
+	Uint32 i;
 
-	/*
-	 *  Close the RingIO to be used with DSP as the writer.
-	 */
-	if (info->writerHandle != NULL) {
-		do {
-			size = RingIO_getValidAttrSize(info->writerHandle);
-		} while (size != 0);
+	/* Local RingIO names, unique per channel and processor */
+	if ((strlen(info->writerName) + 3u) >= RING_IO_NAME_LEN) {
+		status = SYS_EINVAL;
+		SET_FAILURE_REASON(status);
+	} else {
+		strcpy(inName, info->writerName);
+		strcat(inName, "_TI");
+		strcpy(outName, info->writerName);
+		strcat(outName, "_TO");
+	}
 
-		/* Ensure that gpp has read all the data */
-		tmpStatus = RingIO_close(info->writerHandle);
-		if (tmpStatus != SYS_OK) {
-			status = tmpStatus;
+	if (status == SYS_OK) {
+		source = MEM_calloc(DSPLINK_SEGID, RING_IO_SELFTEST_FRAMESIZE,
+				DSPLINK_BUF_ALIGN);
+		frame = MEM_calloc(DSPLINK_SEGID, RING_IO_SELFTEST_FRAMESIZE,
+				DSPLINK_BUF_ALIGN);
+		test = MEM_calloc(DSPLINK_SEGID, sizeof(TSKRING_IO_TransferInfo),
+				DSPLINK_BUF_ALIGN);
+		if ((source == NULL) || (frame == NULL) || (test == NULL)) {
+			status = SYS_EALLOC;
 			SET_FAILURE_REASON(status);
-		} else {
-			info->writerHandle = NULL;
 		}
 	}
 
-	/*
-	 *  Delete the RingIO to be used with DSP as the writer.
+	/* Both RingIOs hold two frames, so the generator never waits. They
+	 * stay on the DSP, in DSP memory, and leave the shared pool alone.
 	 */
-	do {
+	if (status == SYS_OK) {
+		ringIoAttrs.transportType = RINGIO_TRANSPORT_DSP_DSP;
+		ringIoAttrs.ctrlPoolId = LOCAL_POOL_ID;
+		ringIoAttrs.dataPoolId = LOCAL_POOL_ID;
+		ringIoAttrs.attrPoolId = LOCAL_POOL_ID;
+		ringIoAttrs.lockPoolId = LOCAL_POOL_ID;
+		ringIoAttrs.dataBufSize = 2u * RING_IO_SELFTEST_FRAMESIZE;
+		ringIoAttrs.footBufSize = 0;
+		ringIoAttrs.attrBufSize = RING_IO_attrBufSize;
+
 #if defined (DSPLINK_LEGACY_SUPPORT)
-		tmpStatus = RingIO_delete (RING_IO_WRITER_NAME1);
+		status = RingIO_create (inName, &ringIoAttrs);
 #else
-		tmpStatus = RingIO_delete(GBL_getProcId(), RING_IO_WRITER_NAME1);
+		status = RingIO_create(GBL_getProcId(), inName, &ringIoAttrs);
 #endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
-		if (tmpStatus != SYS_OK) {
+		inCreated = (status == SYS_OK);
+		if (status == SYS_OK) {
+#if defined (DSPLINK_LEGACY_SUPPORT)
+			status = RingIO_create (outName, &ringIoAttrs);
+#else
+			status = RingIO_create(GBL_getProcId(), outName, &ringIoAttrs);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
+			outCreated = (status == SYS_OK);
 		}
-	} while (tmpStatus != SYS_OK);
-
-	/*
-	 *  Close the RingIO to be used with DSP as the reader.
-	 */
-	if (info->readerHandle != NULL) {
-		do {
+		if (status != SYS_OK) {
+			SET_FAILURE_REASON(status);
+		}
+	}
 
-			status = RingIO_close(info->readerHandle);
-			if (status != SYS_OK) {
-				SET_FAILURE_REASON(status);
-			} else {
-				info->readerHandle = NULL;
-			}
-		} while (status != SYS_OK);
+	/* Same cache flags as the channel RingIOs, so the cost is the same */
+	if (status == SYS_OK) {
+		flags = RINGIO_DATABUF_CACHEUSE | RINGIO_ATTRBUF_CACHEUSE
+				| RINGIO_CONTROL_CACHEUSE;
+		genHandle = RingIO_open(inName, RINGIO_MODE_WRITE, flags);
+		inHandle = RingIO_open(inName, RINGIO_MODE_READ,
+				(info->prefetchNext == TRUE) ?
+						(flags & ~RINGIO_DATABUF_CACHEUSE) : flags);
+		if (info->writerFlexible == FALSE) {
+			flags |= RINGIO_NEED_EXACT_SIZE;
+		}
+		outHandle = RingIO_open(outName, RINGIO_MODE_WRITE, flags);
+		drainHandle = RingIO_open(outName, RINGIO_MODE_READ,
+				flags & ~RINGIO_NEED_EXACT_SIZE);
+		if ((genHandle == NULL) || (inHandle == NULL) || (outHandle == NULL)
+				|| (drainHandle == NULL)) {
+			status = RINGIO_EFAILURE;
+			SET_FAILURE_REASON(status);
+		}
 	}
 
-	/* Free the info structure */
-	freeStatus = MEM_free(DSPLINK_SEGID, info, sizeof(TSKRING_IO_TransferInfo));
+	/* A copy of the channel between frames, on the local RingIOs. Its
+	 * counters stay apart from the channel ones.
+	 */
+	if (status == SYS_OK) {
+		memcpy(test, info, sizeof(TSKRING_IO_TransferInfo));
+		memset(&(test->stats), 0, sizeof(test->stats));
+		test->readerHandle = inHandle;
+		test->writerHandle = outHandle;
+		SEM_new(&(test->writerSemObj), 0);
+		SEM_new(&(test->readerSemObj), 0);
+		TSKRING_IO_eventInit(test);
+		test->exitflag = FALSE;
+		test->dropFrame = FALSE;
+		test->passFrame = FALSE;
+		test->repeatFrame = FALSE;
+		test->repeatCheck = FALSE;
+		test->packStart = FALSE;
+		test->packWords = 0;
+		test->notifyFrames = 1u;
+		test->notifyBytes = 0;
+		test->notifyPendFrames = 0;
+		test->notifyPendBytes = 0;
+		test->notifyDue = FALSE;
+		test->stageClock = stageTime;
+		test->inNext = NULL;
+		test->inBase = NULL;
+		test->inEnd = NULL;
+		test->inTouched = NULL;
+		test->inTouchedSize = 0;
+
+		status = RingIO_setNotifier(inHandle, RINGIO_NOTIFICATION_ONCE, 0,
+				&TSKRING_IO_reader_notify, (RingIO_NotifyParam) test);
+		if (status == SYS_OK) {
+			status = RingIO_setNotifier(outHandle, RINGIO_NOTIFICATION_ONCE,
+					RINGIO_WRITE_ACQ_SIZE, &TSKRING_IO_writer_notify,
+					(RingIO_NotifyParam) test);
+		}
+		if (status == SYS_OK) {
+			/* Takes the notifications of the writer, nothing to wake */
+			status = RingIO_setNotifier(drainHandle, RINGIO_NOTIFICATION_ONCE,
+					0, &TSKRING_IO_writer_notify, NULL);
+		}
+		if (status != SYS_OK) {
+			SET_FAILURE_REASON(status);
+		}
+	}
 
-	if ((status == SYS_OK) && (freeStatus != TRUE)) {
-		status = SYS_EFREE;
-		SET_FAILURE_REASON(status);
+	if (status == SYS_OK) {
+		for (i = 0; i < RING_IO_SELFTEST_FRAMESIZE; i++) {
+			source[i] = (Char) i;
+		}
+		for (i = 0; i < TSKRING_IO_MAX_STAGES; i++) {
+			stageTime[i] = 0;
+		}
 	}
 
-	return (status);
-}
+	for (n = 0; (n < RING_IO_SELFTEST_FRAMES) && (status == SYS_OK); n++) {
+		status = TSKRING_IO_selfMove(genHandle, source,
+				RING_IO_SELFTEST_FRAMESIZE, TRUE);
+
+		/* Channel side: the reader, stages and writer of the frame loop */
+		if (status == SYS_OK) {
+			frameStart = CLK_gethtime();
+			test->procOffset = 0;
+			test->procTime = 0;
+			test->procAborted = FALSE;
+			size = TSKRING_IO_readFrame(test, frame,
+					RING_IO_SELFTEST_FRAMESIZE, 0, FALSE);
+			status = TSKRING_IO_runStages(test, frame, size);
+			if (status == SYS_OK) {
+				tmpStatus = TSKRING_IO_writeFrame(test, frame, size,
+						RING_IO_SELFTEST_FRAMESIZE);
+				if (tmpStatus != RINGIO_SUCCESS) {
+					status = tmpStatus;
+				}
+			}
+			frameStart = CLK_gethtime() - frameStart;
+			pathTime += frameStart;
+			if (frameStart < bestTime) {
+				bestTime = frameStart;
+			}
+		}
 
-Int TSKRING_IO_delete2(TSKRING_IO_TransferInfo * info) {
-	Int status = SYS_OK;
-	Int tmpStatus = SYS_OK;
-	Bool freeStatus = FALSE;
-	Uint32 size = 0;
+		if (status == SYS_OK) {
+			status = TSKRING_IO_selfMove(drainHandle, NULL,
+					RING_IO_SELFTEST_FRAMESIZE, FALSE);
+		}
+	}
 
-	/*
-	 *  Close the RingIO to be used with DSP as the writer.
-	 */
-	if (info->writerHandle != NULL) {
-		do {
-			size = RingIO_getValidAttrSize(info->writerHandle);
-		} while (size != 0);
+	if (status == SYS_OK) {
+		countsPerMs = CLK_countspms();
+		pathTime = (pathTime != 0) ? pathTime : 1u;
+		bestTime = (bestTime != 0) ? bestTime : 1u;
+		info->stats.selfTests++;
+		info->stats.selfPeakMBps = ((Float) RING_IO_SELFTEST_FRAMESIZE
+				* (Float) countsPerMs) / ((Float) bestTime * 1000.0f);
+		info->stats.selfFramesPerSec = ((Float) RING_IO_SELFTEST_FRAMES
+				* (Float) countsPerMs * 1000.0f) / (Float) pathTime;
+		for (i = 0; i < TSKRING_IO_MAX_STAGES; i++) {
+			info->stats.selfStageCycles[i] = (Uint32) (((Float) stageTime[i]
+					* info->cyclesPerHtime) / (Float) RING_IO_SELFTEST_FRAMES);
+		}
+	}
 
-		/* Ensure that gpp has read all the data */
-		tmpStatus = RingIO_close(info->writerHandle);
+	/* Tear down whatever was set up */
+	if (genHandle != NULL) {
+		RingIO_close(genHandle);
+	}
+	if (inHandle != NULL) {
+		RingIO_close(inHandle);
+	}
+	if (outHandle != NULL) {
+		RingIO_close(outHandle);
+	}
+	if (drainHandle != NULL) {
+		RingIO_close(drainHandle);
+	}
+	if (inCreated) {
+#if defined (DSPLINK_LEGACY_SUPPORT)
+		tmpStatus = RingIO_delete (inName);
+#else
+		tmpStatus = RingIO_delete(GBL_getProcId(), inName);
+#endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
 		if (tmpStatus != SYS_OK) {
-			status = tmpStatus;
-			SET_FAILURE_REASON(status);
-		} else {
-			info->writerHandle = NULL;
+			SET_FAILURE_REASON(tmpStatus);
 		}
 	}
-
-	/*
-	 *  Delete the RingIO to be used with DSP as the writer.
-	 */
-	do {
+	if (outCreated) {
 #if defined (DSPLINK_LEGACY_SUPPORT)
-		tmpStatus = RingIO_delete (RING_IO_WRITER_NAME2);
+		tmpStatus = RingIO_delete (outName);
 #else
-		tmpStatus = RingIO_delete(GBL_getProcId(), RING_IO_WRITER_NAME2);
+		tmpStatus = RingIO_delete(GBL_getProcId(), outName);
 #endif /* if defined (DSPLINK_LEGACY_SUPPORT) */
 		if (tmpStatus != SYS_OK) {
+			SET_FAILURE_REASON(tmpStatus);
 		}
-	} while (tmpStatus != SYS_OK);
-
-	/*
-	 *  Close the RingIO to be used with DSP as the reader.
-	 */
-	if (info->readerHandle != NULL) {
-		do {
-
-			status = RingIO_close(info->readerHandle);
-			if (status != SYS_OK) {
-				SET_FAILURE_REASON(status);
-			} else {
-				info->readerHandle = NULL;
-			}
-		} while (status != SYS_OK);
 	}
-
-	/* Free the info structure */
-	freeStatus = MEM_free(DSPLINK_SEGID, info, sizeof(TSKRING_IO_TransferInfo));
-
-	if ((status == SYS_OK) && (freeStatus != TRUE)) {
-		status = SYS_EFREE;
-		SET_FAILURE_REASON(status);
+	if (source != NULL) {
+		MEM_free(DSPLINK_SEGID, source, RING_IO_SELFTEST_FRAMESIZE);
+	}
+	if (frame != NULL) {
+		MEM_free(DSPLINK_SEGID, frame, RING_IO_SELFTEST_FRAMESIZE);
+	}
+	if (test != NULL) {
+		MEM_free(DSPLINK_SEGID, test, sizeof(TSKRING_IO_TransferInfo));
 	}
 
 	return (status);
 }
 
 /** ----------------------------------------------------------------------------
- *  @func   RING_IO_apply
+ *  @func   TSKRING_IO_selfMove
  *
- *  @desc   This function multiples or divides the data in the buffer by a value
- *          specified in the factor variable.(inplace processing)
- *  @field buffer
- *       data buffer that needs to be processed.
- *  @field factor
- *        scale value
- *  @field opCode
- *         specifies the operation to be performed
- *       (OP_MULTIPLY/OP_DIVIDE)
- *  @field size
- *        size of the buffer that needs to be processed.
+ *  @desc   Feeds a frame into, or drains one from, a local RingIO of the
+ *          self-test.
  *
  *  @modif  buffer
  *  ----------------------------------------------------------------------------
  */
-static Void RING_IO_apply(RingIO_BufPtr * buffer, Uint32 factor, Uint32 opCode,
-		Uint32 size) {
-	Uint32 i = 0;
-	Uint8 maduSize = DSP_MAUSIZE;
-	Uint8 * ptr8;
-	Uint16 * ptr16;
-
-	if (buffer != NULL) {
-		ptr8 = (Uint8 *) (buffer);
-		ptr16 = (Uint16 *) (buffer);
-
-		for (i = 0; i < (size / DSP_MAUSIZE); i++) {
-			switch (opCode) {
-			case OP_MULTIPLY:
-				if (maduSize == 1u) {
-					*ptr8 = (*ptr8) * factor;
-					ptr8++;
-				} else {
-					/* DSP_MAUSIZE == 2 */
-					*ptr16 = (*ptr16) * factor;
-					ptr16++;
-				}
-				break;
+static Int TSKRING_IO_selfMove(RingIO_Handle handle, Char * buffer,
+		Uint32 size, Bool writer) {
+	Int status = SYS_OK;
+	Int ringStatus;
+	RingIO_BufPtr span;
+	Uint32 moved = 0;
+	Uint32 got;
+	Uint32 attr[MAX_VATTR_NUM];
+	Uint32 attrSize;
+	Uint32 param;
+	Uint16 type;
 
-			case OP_DIVIDE:
-				if (maduSize == 1u) {
-					*ptr8 = (*ptr8) / factor;
-					ptr8++;
+	while ((moved < size) && (status == SYS_OK)) {
+		got = size - moved;
+		ringStatus = RingIO_acquire(handle, &span, &got);
+		if ((got != 0) && ((ringStatus == RINGIO_SUCCESS)
+				|| (ringStatus == RINGIO_EBUFWRAP)
+				|| (ringStatus == RINGIO_ENOTCONTIGUOUSDATA)
+				|| (ringStatus == RINGIO_SPENDINGATTRIBUTE))) {
+			if (writer == TRUE) {
+				/* The size of the span, at its start */
+				attr[0] = got;
+				ringStatus = RingIO_setvAttribute(handle, 0, 0, 0, attr,
+						sizeof(attr));
+				if (ringStatus != RINGIO_SUCCESS) {
+					status = ringStatus;
+					SET_FAILURE_REASON(status);
+					RingIO_cancel(handle);
+					got = 0;
+				}
+			}
+			if ((buffer != NULL) && (got != 0)) {
+				if (writer == TRUE) {
+					memcpy(span, buffer + moved, got);
 				} else {
-					/* DSP_MAUSIZE == 2 */
-					*ptr16 = (*ptr16) / factor;
-					ptr16++;
+					memcpy(buffer + moved, span, got);
 				}
-				break;
-
-			default:
-				break;
-
 			}
+			if (got != 0) {
+				ringStatus = RingIO_release(handle, got);
+				if (ringStatus != RINGIO_SUCCESS) {
+					status = ringStatus;
+					SET_FAILURE_REASON(status);
+				}
+				moved += got;
+			}
+		} else if (ringStatus == RINGIO_SPENDINGATTRIBUTE) {
+			ringStatus = RingIO_getAttribute(handle, &type, &param);
+			if (ringStatus == RINGIO_EVARIABLEATTRIBUTE) {
+				attrSize = sizeof(attr);
+				ringStatus = RingIO_getvAttribute(handle, &type, &param, attr,
+						&attrSize);
+			}
+			if ((ringStatus != RINGIO_SUCCESS)
+					&& (ringStatus != RINGIO_SPENDINGATTRIBUTE)) {
+				status = ringStatus;
+				SET_FAILURE_REASON(status);
+			}
+		} else {
+			/* The RingIOs are sized for a frame, nothing to wait for */
+			status = ringStatus;
+			SET_FAILURE_REASON(status);
+		}
+	}
+
+	/* The generated frame ends like a GPP frame */
+	if ((writer == TRUE) && (status == SYS_OK)) {
+		status = RingIO_setAttribute(handle, 0, (Uint16) RINGIO_DATA_END, 0);
+		if (status != RINGIO_SUCCESS) {
+			SET_FAILURE_REASON(status);
 		}
 	}
+
+	return (status);
 }
 
 /** ----------------------------------------------------------------------------
- *  @func   TSKRING_IO_reader_notify
+ *  @func   TSKRING_IO_packPut
  *
- *  @desc   This function implements the notification callback for the RingIO1
- *          opened by the DSP in  reader mode.
+ *  @desc   Adds a key/value pair to the pending packed record.
  *
- *  @modif  None
+ *  @modif  info->packOut, info->packWords
  *  ----------------------------------------------------------------------------
  */
-static Void TSKRING_IO_reader_notify(RingIO_Handle handle,
-		RingIO_NotifyParam param, RingIO_NotifyMsg msg) {
-	TSKRING_IO_TransferInfo * info;
-	(Void) handle; /* To avoid compiler warning */
-	(Void) msg; /* To avoid compiler warning */
-
-	if (param != NULL) {
-		info = (TSKRING_IO_TransferInfo *) param;
-
-		switch (msg) {
-		case NOTIFY_DATA_START:
-			/* Got data transfer start notification  From GPP
-			 * (RINGIO1)
-			 */
-			info->freadStart = TRUE;
-			break;
+static Void TSKRING_IO_packPut(TSKRING_IO_TransferInfo * info, Uint32 key,
+		Uint32 value) {
+	Uint32 i;
 
-		case NOTIFY_DATA_END:
-			/* Got data transfer end  notification  From GPP
-			 * (RINGIO1)
-			 */
-			info->freadEnd = TRUE;
-			break;
-		case NOTIFY_DSP_END:
-			
-			info->exitflag = TRUE;
-			/*RingIO_sendNotify(info->writerHandle,
-							(RingIO_NotifyMsg)(8));*/
-			break;
-		default:
-			break;
+	for (i = 0; (i < info->packWords) && (info->packOut[i] != key); i += 2u) {
+	}
+	if (i < RING_IO_PACK_WORDS) {
+		info->packOut[i] = key;
+		info->packOut[i + 1u] = value;
+		if (i == info->packWords) {
+			info->packWords += 2u;
+		}
+	}
+}
 
+/** ----------------------------------------------------------------------------
+ *  @func   TSKRING_IO_packFlush
+ *
+ *  @desc   Sets the pending packed record on the output RingIO.
+ *
+ *  @modif  info->packWords, info->packStart
+ *  ----------------------------------------------------------------------------
+ */
+static Int TSKRING_IO_packFlush(TSKRING_IO_TransferInfo * info) {
+	Int status = RINGIO_SUCCESS;
+
+	if (info->packWords != 0) {
+		status = RingIO_setvAttribute(info->writerHandle, 0,
+				(Uint16) RINGIO_DATA_PACKED, 0, info->packOut,
+				info->packWords * sizeof(Uint32));
+		if (status == RINGIO_SUCCESS) {
+			info->packWords = 0;
 		}
+	}
 
-		/* Post the semaphore. */
-		SEM_post((SEM_Handle) & (info->readerSemObj));
+	/* Sending the Hard Notification to gpp reader */
+	while ((status == RINGIO_SUCCESS) && (info->packStart == TRUE)
+			&& (!info->exitflag)) {
+		status = TSKRING_IO_outNotify(info,
+				(RingIO_NotifyMsg) NOTIFY_DATA_START, 0);
+		if (status != RINGIO_SUCCESS) {
+			SET_FAILURE_REASON(status);
+			status = RINGIO_SUCCESS;
+		} else {
+			info->packStart = FALSE;
+		}
 	}
+
+	return (status);
 }
 
 /** ----------------------------------------------------------------------------
- *  @func   TSKRING_IO_writer_notify
+ *  @func   TSKRING_IO_unpack
  *
- *  @desc   This function implements the notification callback for the RingIO2
- *          opened by the DSP in writer  mode.
+ *  @desc   Applies a packed record taken from the input RingIO.
  *
- *  @modif  None
+ *  @modif  info->sampleFormat
  *  ----------------------------------------------------------------------------
  */
-static Void TSKRING_IO_writer_notify(RingIO_Handle handle,
-		RingIO_NotifyParam param, RingIO_NotifyMsg msg) {
-	TSKRING_IO_TransferInfo * info;
-	(Void) handle; /* To avoid compiler warning */
-	(Void) msg; /* To avoid compiler warning */
+static Uint32 TSKRING_IO_unpack(TSKRING_IO_TransferInfo * info, Uint32 bytes,
+		Uint32 * stamp, Uint32 * size) {
+	Uint32 keys = 0;
+	Uint32 words;
+	Uint32 key;
+	Uint32 i;
 
-	if (param != NULL) {
-		info = (TSKRING_IO_TransferInfo *) param;
-		/* Post the semaphore. */
-		SEM_post((SEM_Handle) & (info->writerSemObj));
+	words = bytes / sizeof(Uint32);
+	words = (words < RING_IO_PACK_WORDS) ? words : RING_IO_PACK_WORDS;
+	for (i = 0; (i + 1u) < words; i += 2u) {
+		key = info->packIn[i];
+		if (key == RING_IO_PACK_SIZE) {
+			*size = info->packIn[i + 1u];
+		} else if (key == RINGIO_DATA_START) {
+			*stamp = info->packIn[i + 1u];
+		} else if (key == RINGIO_DATA_FORMAT) {
+			info->sampleFormat = info->packIn[i + 1u];
+		}
+		if (key < 32u) {
+			keys |= RING_IO_PACK_BIT(key);
+		}
 	}
-}
 
+	return (keys);
+}
@@ -52,10 +52,260 @@
 #include <ringiodefs.h>
 #include <ringio.h>
 
+/*  --------------------------- Sample Headers ---------------------------- */
+#include <ring_io_protocol.h>
+#include <ring_io_place.h>
+
 #if defined (__cplusplus)
 extern "C" {
 #endif /* defined (__cplusplus) */
 
+/** ============================================================================
+ *  @name   TSKRING_IO_ShedPolicy
+ *
+ *  @desc   Load shedding policy applied to a channel while it is overloaded.
+ *
+ *  @field  SHED_POLICY_NONE
+ *              Never shed, frames back up in the input RingIO.
+ *  @field  SHED_POLICY_DROP_OLDEST
+ *              Drop the oldest pending frame until the overload clears.
+ *  @field  SHED_POLICY_DROP_NTH
+ *              Drop every Nth frame while the overload persists.
+ *  @field  SHED_POLICY_PASSTHROUGH
+ *              Forward frames without running the processing stages.
+ *  ============================================================================
+ */
+typedef enum {
+    SHED_POLICY_NONE        = 0u,
+    SHED_POLICY_DROP_OLDEST = 1u,
+    SHED_POLICY_DROP_NTH    = 2u,
+    SHED_POLICY_PASSTHROUGH = 3u
+} TSKRING_IO_ShedPolicy ;
+
+/** ============================================================================
+ *  @const  TSKRING_IO_MAX_STAGES
+ *
+ *  @desc   Maximum number of processing stages per channel.
+ *  ============================================================================
+ */
+#define TSKRING_IO_MAX_STAGES  4u
+
+/** ============================================================================
+ *  @const  TSKRING_IO_OVERRUN_BINS
+ *
+ *  @desc   Number of bins in the processing budget overrun histogram.
+ *          Bins hold overruns of <25%, <50%, <100%, <200% and >=200% of the
+ *          budget.
+ *  ============================================================================
+ */
+#define TSKRING_IO_OVERRUN_BINS 5u
+
+/** ============================================================================
+ *  @name   TSKRING_IO_StageFxn
+ *
+ *  @desc   Signature of a processing stage. A stage processes size bytes of
+ *          the frame buffer in place. Stages are called once per block of
+ *          at most RING_IO_STAGE_BLOCKSIZE bytes, in frame order.
+ *  ============================================================================
+ */
+struct TSKRING_IO_TransferInfo_tag ;
+typedef Int (*TSKRING_IO_StageFxn) (struct TSKRING_IO_TransferInfo_tag * info,
+                                    Char *                               buffer,
+                                    Uint32                               size) ;
+
+/** ============================================================================
+ *  @name   TSKRING_IO_Stage
+ *
+ *  @desc   Processing stage registered on a channel.
+ *
+ *  @field  fxn
+ *              Full quality implementation of the stage.
+ *  @field  fallbackFxn
+ *              Cheaper implementation used while the channel is degraded.
+ *              NULL if the stage has no cheaper variant.
+ *  ============================================================================
+ */
+typedef struct TSKRING_IO_Stage_tag {
+    TSKRING_IO_StageFxn fxn ;
+    TSKRING_IO_StageFxn fallbackFxn ;
+} TSKRING_IO_Stage ;
+
+/** ============================================================================
+ *  @const  TSKRING_IO_EVENT_QUEUE_LEN
+ *
+ *  @desc   Depth of the per-channel queue of start events, a power of two.
+ *          Starts beyond it are folded into a count, see
+ *          TSKRING_IO_EventQueue.
+ *  ============================================================================
+ */
+#define TSKRING_IO_EVENT_QUEUE_LEN  16u
+
+/** ============================================================================
+ *  @name   TSKRING_IO_Event
+ *
+ *  @desc   Notification received from the GPP on the input RingIO.
+ *
+ *  @field  id
+ *              Notification message (NOTIFY_DATA_START, ...).
+ *  @field  stamp
+ *              CLK_gethtime() value when the notification arrived, or when
+ *              the task took it for a folded start or a control event.
+ *  ============================================================================
+ */
+typedef struct TSKRING_IO_Event_tag {
+    Uint32         id ;
+    Uint32         stamp ;
+} TSKRING_IO_Event ;
+
+/** ============================================================================
+ *  @name   TSKRING_IO_EventQueue
+ *
+ *  @desc   Single producer, single consumer queue of events, filled by the
+ *          notification callback and drained by the channel task. Only
+ *          start events take a slot. When the slots are full, starts are
+ *          folded into a count and queued again once the task has taken
+ *          them all, so they stay in order and none is lost. The exit and
+ *          self-test requests are kept as counts, and the other
+ *          notifications only post the reader semaphore. Each field is
+ *          written either only by the producer or only by the consumer, so
+ *          no lock is needed.
+ *
+ *  @field  head
+ *              Free running count of events put, written by the producer.
+ *  @field  tail
+ *              Free running count of events taken, written by the consumer.
+ *  @field  folded
+ *              Free running count of starts folded, written by the producer.
+ *  @field  unfolded
+ *              Free running count of folded starts taken, written by the
+ *              consumer.
+ *  @field  selfTests
+ *              Free running count of self-test requests, written by the
+ *              producer.
+ *  @field  selfTestsTaken
+ *              Free running count of self-test requests taken, written by
+ *              the consumer.
+ *  @field  exitPosted
+ *              TRUE once NOTIFY_DSP_END has arrived.
+ *  @field  events
+ *              Event slots, indexed modulo TSKRING_IO_EVENT_QUEUE_LEN.
+ *  ============================================================================
+ */
+typedef struct TSKRING_IO_EventQueue_tag {
+    volatile Uint32  head ;
+    volatile Uint32  tail ;
+    volatile Uint32  folded ;
+    volatile Uint32  unfolded ;
+    volatile Uint32  selfTests ;
+    volatile Uint32  selfTestsTaken ;
+    volatile Bool    exitPosted ;
+    TSKRING_IO_Event events [TSKRING_IO_EVENT_QUEUE_LEN] ;
+} TSKRING_IO_EventQueue ;
+
+/** ============================================================================
+ *  @name   TSKRING_IO_Stats
+ *
+ *  @desc   Per-channel counters maintained by the execute phase.
+ *
+ *  @field  framesIn
+ *              Number of frames received on the input RingIO.
+ *  @field  framesOut
+ *              Number of frames written to the output RingIO.
+ *  @field  framesShed
+ *              Number of frames dropped by the load shedding policy.
+ *  @field  framesPassed
+ *              Number of frames forwarded without processing.
+ *  @field  deadlineMisses
+ *              Number of frames that took longer than the frame deadline.
+ *  @field  overloadEvents
+ *              Number of transitions into the overloaded state.
+ *  @field  qualitySwitches
+ *              Number of switches between full and fallback stage variants.
+ *  @field  framesLate
+ *              Number of frames that reached the jitter buffer after their
+ *              release slot.
+ *  @field  framesEarly
+ *              Number of frames that reached the jitter buffer more than the
+ *              maximum delay ahead of their release slot.
+ *  @field  framesAborted
+ *              Number of frames whose processing was cut short at a block
+ *              boundary because it exceeded the budget.
+ *  @field  cyclesLast
+ *              Processing cycles spent on the last frame.
+ *  @field  cyclesMax
+ *              Highest processing cycles spent on a frame.
+ *  @field  overrunHist
+ *              Histogram of budget overruns, see TSKRING_IO_OVERRUN_BINS.
+ *  @field  readAcquires
+ *              Number of successful reader acquires.
+ *  @field  writePartials
+ *              Number of writer acquires that returned less than requested.
+ *  @field  notifySent
+ *              Number of notifications sent to the GPP on the output RingIO.
+ *  @field  notifyCoalesced
+ *              Number of output notifications left out by the moderation.
+ *  @field  eventsFolded
+ *              Number of start notifications folded into a count because the
+ *              event queue was full.
+ *  @field  startsMissed
+ *              Number of start notifications without a start attribute at the
+ *              read position.
+ *  @field  blocksOverlapped
+ *              Number of stage blocks processed while an input copy was in
+ *              flight.
+ *  @field  repeatChecks
+ *              Number of frames checked for a repeat.
+ *  @field  repeatHits
+ *              Number of checked frames that repeated the previous one.
+ *  @field  ctrlOpsSaved
+ *              Number of RingIO control operations (cancel of an oversized
+ *              writer acquire) avoided by sizing acquires to the frame:
+ *              one per frame whose size is not a multiple of
+ *              RINGIO_WRITE_ACQ_SIZE, counted when its last chunk is
+ *              released.
+ *  @field  selfTests
+ *              Number of loopback self-tests run, see NOTIFY_DSP_SELFTEST.
+ *  @field  selfPeakMBps
+ *              Throughput of the channel path in the last self-test, in
+ *              MB/s, from its fastest frame.
+ *  @field  selfFramesPerSec
+ *              Frames per second of the channel path in the last self-test,
+ *              over all its frames.
+ *  @field  selfStageCycles
+ *              Mean cycles per frame spent in each processing stage in the
+ *              last self-test.
+ *  ============================================================================
+ */
+typedef struct TSKRING_IO_Stats_tag {
+    Uint32         framesIn ;
+    Uint32         framesOut ;
+    Uint32         framesShed ;
+    Uint32         framesPassed ;
+    Uint32         deadlineMisses ;
+    Uint32         overloadEvents ;
+    Uint32         qualitySwitches ;
+    Uint32         framesLate ;
+    Uint32         framesEarly ;
+    Uint32         framesAborted ;
+    Uint32         cyclesLast ;
+    Uint32         cyclesMax ;
+    Uint32         overrunHist [TSKRING_IO_OVERRUN_BINS] ;
+    Uint32         readAcquires ;
+    Uint32         writePartials ;
+    Uint32         notifySent ;
+    Uint32         notifyCoalesced ;
+    Uint32         eventsFolded ;
+    Uint32         startsMissed ;
+    Uint32         blocksOverlapped ;
+    Uint32         repeatChecks ;
+    Uint32         repeatHits ;
+    Uint32         ctrlOpsSaved ;
+    Uint32         selfTests ;
+    Float          selfPeakMBps ;
+    Float          selfFramesPerSec ;
+    Uint32         selfStageCycles [TSKRING_IO_MAX_STAGES] ;
+} TSKRING_IO_Stats ;
+
 /** ============================================================================
  *  @name   TSKRING_IO_TransferInfo
  *
@@ -66,6 +316,11 @@ extern "C" {
  *              Handle to the RingIO used by the application in writer mode.
  *  @field  readerHandle
  *              Handle to the RingIO used by the application in reader mode.
+ *  @field  writerName
+ *              Name of the RingIO opened in writer mode, see
+ *              RING_IO_placeName.
+ *  @field  readerName
+ *              Name of the RingIO opened in reader mode.
  *  @field  writerSemObj
  *              Semaphore used for RingIO notification for the writer.
  *  @field  readerSemObj
@@ -85,21 +340,204 @@ extern "C" {
  *  @field  scaleOpCode
  *              contains OP_MULTIPLY and OP_DIVIDE based on the received
  *              variable attribute.
+ *  @field  scaleTable
+ *              Shared scale lookup table of scaleOpCode and scalingFactor,
+ *              NULL to compute the samples, see TSKRING_IO_scaleTable.
+ *  @field  scaleShift
+ *              Shift of the fallback scale stage, scalingFactor rounded to a
+ *              power of two, see RING_IO_scaleLog2.
  *  @field  scaleSize
  *              contains the size of the buffer  on which  processing needs
  *              to be done.
- *  @field  freadStart
- *              boolean flag. if TRUE,  DSP application can start
- *              reading data  from RINGIO1.
- *  @field  freadEnd
- *              boolean flag. if TRUE,  DSP application stops
- *              reading data  from RINGIO1.
- *              .
+ *  @field  events
+ *              Notifications from the GPP, see TSKRING_IO_EventQueue.
+ *  @field  exitflag
+ *              Set by the task when it takes NOTIFY_DSP_END from the event
+ *              queue.
+ *  @field  shedPolicy
+ *              Load shedding policy of the channel (TSKRING_IO_ShedPolicy).
+ *  @field  shedNth
+ *              Frame interval used by SHED_POLICY_DROP_NTH.
+ *  @field  shedFillMark
+ *              Input RingIO fill level (percent) at which a channel whose
+ *              frames are late is considered overloaded. 0 disables the fill
+ *              check.
+ *  @field  shedLowMark
+ *              Input RingIO fill level (percent) down to which an overloaded
+ *              channel stays overloaded.
+ *  @field  shedDeadline
+ *              Frame deadline in CLK_gethtime() counts. 0 disables the
+ *              deadline check.
+ *  @field  shedMissLimit
+ *              Consecutive deadline misses after which the channel is
+ *              considered overloaded.
+ *  @field  shedMissCount
+ *              Current run of consecutive deadline misses.
+ *  @field  shedCount
+ *              Frames seen since the channel became overloaded.
+ *  @field  frameStart
+ *              CLK_gethtime() value when the current frame started.
+ *  @field  overloaded
+ *              TRUE while the overload detector is asserted.
+ *  @field  dropFrame
+ *              TRUE if the current frame is being dropped.
+ *  @field  passFrame
+ *              TRUE if the current frame bypasses the processing stages.
+ *  @field  fillLevel
+ *              Input RingIO fill level (percent) sampled at frame start.
+ *  @field  stages
+ *              Processing stages run on every frame, in order.
+ *  @field  numStages
+ *              Number of registered processing stages.
+ *  @field  degraded
+ *              TRUE while the fallback stage variants are in use.
+ *  @field  degradeLoadHi
+ *              Stage load (percent of the frame period) at which the channel
+ *              degrades, see RING_IO_DEGRADE_LOADHI.
+ *  @field  degradeLoadLo
+ *              Stage load under which the channel may recover.
+ *  @field  degradeFillHi
+ *              Input RingIO fill level (percent) at which the channel
+ *              degrades, see RING_IO_DEGRADE_FILLHI.
+ *  @field  degradeFillLo
+ *              Input RingIO fill level under which the channel may recover.
+ *  @field  stageTime
+ *              CLK_gethtime() counts spent in the stages for the last frame.
+ *  @field  procOffset
+ *              Bytes of the current frame already run through the stages.
+ *  @field  procTime
+ *              CLK_gethtime() counts spent in the stages so far for the
+ *              current frame.
+ *  @field  procAborted
+ *              TRUE once the stages of the current frame were cut short by
+ *              the budget.
+ *  @field  stageClock
+ *              Per-stage CLK_gethtime() accumulators, NULL except on the
+ *              self-test path, see TSKRING_IO_selfTest.
+ *  @field  framePeriod
+ *              CLK_gethtime() counts between the last two frame starts.
+ *  @field  frameBytes
+ *              Bytes of the last frame read, for the backlog latency of
+ *              TSKRING_IO_shedCheck.
+ *  @field  arrivalTime
+ *              Time stamp of the NOTIFY_DATA_START event of the current frame.
+ *  @field  jitterMinDelay
+ *              Minimum jitter buffer delay in CLK_gethtime() counts.
+ *              0 disables the jitter buffer.
+ *  @field  jitterMaxDelay
+ *              Maximum jitter buffer delay in CLK_gethtime() counts.
+ *  @field  jitterDelay
+ *              Current jitter buffer target delay.
+ *  @field  jitter
+ *              Interarrival jitter estimate in CLK_gethtime() counts.
+ *  @field  jitterPeriod
+ *              Frame period used for the release cadence.
+ *  @field  lastArrival
+ *              Arrival time of the previous frame.
+ *  @field  lastStamp
+ *              GPP timestamp of the previous frame.
+ *  @field  lastRelease
+ *              Release slot of the previous frame.
+ *  @field  budget
+ *              Processing budget in CPU cycles per frame. 0 disables budget
+ *              accounting.
+ *  @field  budgetHtime
+ *              Processing budget in CLK_gethtime() counts.
+ *  @field  budgetAbort
+ *              If TRUE, processing stops at the first block boundary past the
+ *              budget and the rest of the frame is forwarded unprocessed.
+ *  @field  cyclesPerHtime
+ *              CPU cycles per CLK_gethtime() count.
+ *  @field  greedyRead
+ *              If TRUE, reader acquires are sized from the valid data in the
+ *              input RingIO, see TSKRING_IO_readSize.
+ *  @field  writerFlexible
+ *              If TRUE, the output RingIO is opened without exact size and
+ *              partial writer acquires are used as they come.
+ *  @field  acqGranule
+ *              Granule of the acquire sizes, see RING_IO_ACQ_GRANULE.
+ *  @field  sampleFormat
+ *              Byte order of the input samples, see RING_IO_copySwap.
+ *  @field  asyncCopy
+ *              If TRUE, native order input is copied with the RING_IO_copy
+ *              engine, overlapped with the stages, see RING_IO_ASYNC_COPY.
+ *              Ignored without RING_IO_COPY_OVERLAP.
+ *  @field  copyEngine
+ *              RING_IO_copy engine of the channel.
+ *  @field  prefetchNext
+ *              If TRUE, the next pending span of the input RingIO is
+ *              touched while the current one is processed, see
+ *              RING_IO_PREFETCH.
+ *  @field  inNext
+ *              End of the last acquired input span, where the next one
+ *              starts unless the reader wraps.
+ *  @field  inBase, inEnd
+ *              Bounds of the input data buffer, known once the reader has
+ *              wrapped around it; NULL until then.
+ *  @field  inTouched, inTouchedSize
+ *              Span last invalidated and touched by the prefetch.
+ *  @field  repeatCheck
+ *              If TRUE, repeated frames skip the stages, see
+ *              RING_IO_REPEAT_CHECK.
+ *  @field  repeatAttr
+ *              If TRUE, repeated frames are sent as a RINGIO_DATA_REPEAT
+ *              attribute instead of the cached output.
+ *  @field  repeatFrame
+ *              TRUE when the current frame goes out as a RINGIO_DATA_REPEAT
+ *              attribute.
+ *  @field  repeatValid
+ *              TRUE when repeatBuf holds the input of the frame of lastHash
+ *              and lastSize, and repeatOut its output.
+ *  @field  frameHash
+ *              Hash of the input of the current frame so far.
+ *  @field  lastHash
+ *              Hash of the last processed frame.
+ *  @field  lastSize
+ *              Size of the last processed frame.
+ *  @field  repeatBuf
+ *              Input of the last processed frame, followed by repeatOut.
+ *  @field  repeatOut
+ *              Output of the last processed frame, not kept with
+ *              repeatAttr.
+ *  @field  packAttrs
+ *              If TRUE, the attributes of a frame go out packed, see
+ *              RING_IO_PACK_ATTRS.
+ *  @field  packStart
+ *              TRUE while the pending packed record holds the start of the
+ *              frame, to be notified once it is set.
+ *  @field  packWords
+ *              Words of the pending packed record.
+ *  @field  packOut
+ *              Pending packed record of the output RingIO.
+ *  @field  packIn
+ *              Variable attribute taken from the input RingIO.
+ *  @field  notifyFrames
+ *              Pending frames that trigger an output notification.
+ *  @field  notifyBytes
+ *              Pending bytes that trigger an output notification, 0 for no
+ *              byte threshold.
+ *  @field  notifyPeriod
+ *              Longest delay of a pending notification in CLK_gethtime()
+ *              counts, 0 for no timer.
+ *  @field  notifyPendFrames
+ *              Frames written since the last output notification.
+ *  @field  notifyPendBytes
+ *              Bytes written since the last output notification.
+ *  @field  notifyPendStart
+ *              CLK_gethtime() of the first pending frame.
+ *  @field  notifyDue
+ *              Set by TSKRING_IO_notifyTick when the pending frames have
+ *              waited notifyPeriod, cleared by the task as it sends the
+ *              notification.
+ *  @field  stats
+ *              Channel counters.
  *  ============================================================================
  */
 typedef struct TSKRING_IO_TransferInfo_tag {
     RingIO_Handle  writerHandle ;
     RingIO_Handle  readerHandle ;
+    Char           writerName [RING_IO_NAME_LEN] ;
+    Char           readerName [RING_IO_NAME_LEN] ;
     SEM_Obj        writerSemObj ;
     SEM_Obj        readerSemObj ;
     Uint32         readerRecvSize ;
@@ -108,10 +546,85 @@ typedef struct TSKRING_IO_TransferInfo_tag {
     Char *         writerBuf  ;
     Uint32         scalingFactor ;
     Uint32         scaleOpCode;
+    const Void *   scaleTable ;
+    Uint32         scaleShift ;
     Uint32         scaleSize;
-    Int8           freadStart;
-    Int8           freadEnd;
+    TSKRING_IO_EventQueue events ;
     Int8           exitflag;
+    Uint32         shedPolicy ;
+    Uint32         shedNth ;
+    Uint32         shedFillMark ;
+    Uint32         shedLowMark ;
+    Uint32         shedDeadline ;
+    Uint32         shedMissLimit ;
+    Uint32         shedMissCount ;
+    Uint32         shedCount ;
+    Uint32         frameStart ;
+    Bool           overloaded ;
+    Bool           dropFrame ;
+    Bool           passFrame ;
+    Uint32         fillLevel ;
+    TSKRING_IO_Stage stages [TSKRING_IO_MAX_STAGES] ;
+    Uint32         numStages ;
+    Bool           degraded ;
+    Uint32         degradeLoadHi ;
+    Uint32         degradeLoadLo ;
+    Uint32         degradeFillHi ;
+    Uint32         degradeFillLo ;
+    Uint32         stageTime ;
+    Uint32         procOffset ;
+    Uint32         procTime ;
+    Bool           procAborted ;
+    Uint32 *       stageClock ;
+    Uint32         framePeriod ;
+    Uint32         frameBytes ;
+    Uint32         arrivalTime ;
+    Uint32         jitterMinDelay ;
+    Uint32         jitterMaxDelay ;
+    Uint32         jitterDelay ;
+    Uint32         jitter ;
+    Uint32         jitterPeriod ;
+    Uint32         lastArrival ;
+    Uint32         lastStamp ;
+    Uint32         lastRelease ;
+    Uint32         budget ;
+    Uint32         budgetHtime ;
+    Bool           budgetAbort ;
+    Float          cyclesPerHtime ;
+    Bool           greedyRead ;
+    Bool           writerFlexible ;
+    Uint32         acqGranule ;
+    Uint32         sampleFormat ;
+    Bool           asyncCopy ;
+    Uint32         copyEngine ;
+    Bool           prefetchNext ;
+    Char *         inNext ;
+    Char *         inBase ;
+    Char *         inEnd ;
+    Char *         inTouched ;
+    Uint32         inTouchedSize ;
+    Bool           repeatCheck ;
+    Bool           repeatAttr ;
+    Bool           repeatFrame ;
+    Bool           repeatValid ;
+    Uint32         frameHash ;
+    Uint32         lastHash ;
+    Uint32         lastSize ;
+    Char *         repeatBuf ;
+    Char *         repeatOut ;
+    Bool           packAttrs ;
+    Bool           packStart ;
+    Uint32         packWords ;
+    Uint32         packOut [RING_IO_PACK_WORDS] ;
+    Uint32         packIn [RING_IO_PACK_WORDS] ;
+    Uint32         notifyFrames ;
+    Uint32         notifyBytes ;
+    Uint32         notifyPeriod ;
+    Uint32         notifyPendFrames ;
+    Uint32         notifyPendBytes ;
+    Uint32         notifyPendStart ;
+    volatile Bool  notifyDue ;
+    TSKRING_IO_Stats stats ;
 } TSKRING_IO_TransferInfo ;
 
 /** ============================================================================
@@ -137,6 +650,58 @@ typedef struct TSKRING_IO_TransferInfo_tag {
 Int TSKRING_IO_create1 (TSKRING_IO_TransferInfo ** transferInfo) ;
 Int TSKRING_IO_create2 (TSKRING_IO_TransferInfo ** transferInfo) ;
 
+/** ============================================================================
+ *  @func   TSKRING_IO_addStage
+ *
+ *  @desc   Appends a processing stage to a channel.
+ *
+ *  @arg    transferInfo
+ *              Information for transfer.
+ *  @arg    fxn
+ *              Full quality implementation of the stage.
+ *  @arg    fallbackFxn
+ *              Cheaper implementation used under load, or NULL.
+ *
+ *  @ret    SYS_OK
+ *              Successful operation.
+ *          SYS_EINVAL
+ *              Invalid stage, or the stage list is full.
+ *
+ *  @enter  transferInfo is created.
+ *
+ *  @leave  None
+ *
+ *  @see    TSKRING_IO_create1, TSKRING_IO_create2
+ *  ============================================================================
+ */
+Int TSKRING_IO_addStage (TSKRING_IO_TransferInfo * transferInfo,
+                         TSKRING_IO_StageFxn       fxn,
+                         TSKRING_IO_StageFxn       fallbackFxn) ;
+
+/** ============================================================================
+ *  @func   TSKRING_IO_notifyTick
+ *
+ *  @desc   PRD function of the output notification timer. The end of
+ *          frame notification of every moderated channel whose pending
+ *          frames have waited longer than its notifyPeriod is marked due and
+ *          the channel task is woken through its reader semaphore; the task
+ *          sends it, as RingIO_sendNotify is not called from SWI context.
+ *          The PRD object is created by ring_io.tci only when
+ *          ringIoNotifyTimer is set.
+ *
+ *  @arg    None
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    RING_IO_NOTIFY_PERIOD
+ *  ============================================================================
+ */
+Void TSKRING_IO_notifyTick (Void) ;
+
 /** ============================================================================
  *  @func   TSKRING_IO_execute
  *